@@ -0,0 +1,139 @@
+/**
+ * @file affinity_bench.cpp
+ * @brief Compares async request latency and its variance with client
+ *        threads unpinned and pinned to one NUMA node
+ *
+ * Usage: affinity_bench [requests] [numa_node] [in_flight]
+ *
+ * Requests run over a session stream, so both the threads running async
+ * callbacks and the gRPC threads completing session calls are pinned. The
+ * difference shows on multi-socket hosts; on a single node both runs
+ * should match.
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void report(const std::string& label, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) {
+        sum += s;
+    }
+    const double mean = sum / samples.size();
+    double squares = 0;
+    for (double s : samples) {
+        squares += (s - mean) * (s - mean);
+    }
+    std::cout << label
+              << ": mean=" << mean << "us"
+              << " stddev=" << std::sqrt(squares / samples.size()) << "us"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " p99=" << samples[samples.size() * 99 / 100] << "us"
+              << " p99.9=" << samples[samples.size() * 999 / 1000] << "us"
+              << " (n=" << samples.size() << ")" << std::endl;
+}
+
+// Keeps in_flight requests outstanding and records each one's latency
+bool run(const std::string& label, ascnd::AscndClient& client, int requests, int in_flight) {
+    if (!client.get_player_rank("leaderboard", "player")) {
+        std::cerr << label << ": warm-up request failed" << std::endl;
+        return false;
+    }
+
+    ascnd::GetPlayerRankRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<double> samples;
+    samples.reserve(requests);
+    int outstanding = 0;
+    int failures = 0;
+
+    for (int i = 0; i < requests; ++i) {
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            cv.wait(lock, [&]() { return outstanding < in_flight; });
+            ++outstanding;
+        }
+        auto start = Clock::now();
+        client.get_player_rank_async(request, [&, start](ascnd::Result<ascnd::GetPlayerRankResponse> result) {
+            double latency = to_us(Clock::now() - start);
+            std::lock_guard<std::mutex> lock(mutex);
+            samples.push_back(latency);
+            failures += result ? 0 : 1;
+            --outstanding;
+            cv.notify_all();
+        });
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    cv.wait(lock, [&]() { return outstanding == 0; });
+    if (failures > 0) {
+        std::cerr << label << ": " << failures << " requests failed" << std::endl;
+        return false;
+    }
+    report(label, samples);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int requests = argc > 1 ? std::atoi(argv[1]) : 5000;
+    if (requests <= 0) {
+        requests = 5000;
+    }
+    int node = argc > 2 ? std::atoi(argv[2]) : 0;
+    int in_flight = argc > 3 ? std::atoi(argv[3]) : 16;
+    if (in_flight <= 0) {
+        in_flight = 16;
+    }
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::testing::FakeAscndService service;
+    ascnd::testing::FakeServer server(&service);
+
+    ascnd::ClientConfig config;
+    config.server_address = server.address();
+    config.api_key = "bench-key";
+    config.use_ssl = false;
+    config.max_retries = 0;
+    config.session_mode = true;
+
+    bool ok = true;
+    {
+        ascnd::AscndClient client(config);
+        ok = run("unpinned", client, requests, in_flight) && ok;
+    }
+    {
+        config.callback_thread_affinity.numa_nodes = {node};
+        config.completion_thread_affinity.numa_nodes = {node};
+        ascnd::AscndClient client(config);
+        ok = run("pinned to node " + std::to_string(node), client, requests, in_flight) && ok;
+    }
+    return ok ? 0 : 1;
+}
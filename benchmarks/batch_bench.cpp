@@ -0,0 +1,131 @@
+/**
+ * @file batch_bench.cpp
+ * @brief Latency of get_player_rank and server calls made per lookup with
+ *        no batching, a fixed batching window and an adaptive one, at idle
+ *        and under load
+ *
+ * Usage: batch_bench [busy_threads] [lookups_per_thread]
+ *
+ * The stand-in server takes 1 ms per call, so batching trades waiting in
+ * the window against queueing for the server.
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+constexpr int kWindowMs = 5;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+// Runs lookups on each thread, pausing between them when idle, and prints
+// latency and server calls per lookup
+bool run(const std::string& label, ascnd::ClientConfig config, ascnd::testing::FakeAscndService& service,
+         int threads, int lookups, Clock::duration pause) {
+    ascnd::AscndClient client(config);
+    if (!client.get_player_rank("leaderboard", "player-0")) {
+        std::cerr << "warm-up request failed" << std::endl;
+        return false;
+    }
+    const int calls_before = service.rank_calls.load() + service.ranks_batch_calls.load();
+
+    std::mutex mutex;
+    std::vector<double> samples;
+    std::atomic<int> failures{0};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&, t]() {
+            const std::string player = "player-" + std::to_string(t);
+            std::vector<double> local;
+            for (int i = 0; i < lookups; ++i) {
+                std::this_thread::sleep_for(pause);
+                auto start = Clock::now();
+                if (!client.get_player_rank("leaderboard", player)) {
+                    ++failures;
+                }
+                local.push_back(to_us(Clock::now() - start));
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            samples.insert(samples.end(), local.begin(), local.end());
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+
+    if (failures > 0) {
+        std::cerr << label << ": " << failures << " lookups failed" << std::endl;
+        return false;
+    }
+    const int calls = service.rank_calls.load() + service.ranks_batch_calls.load() - calls_before;
+    const ascnd::BatchHistogram& windows = client.stats().rank_batch_windows;
+    std::sort(samples.begin(), samples.end());
+    std::cout << label
+              << ": p50=" << samples[samples.size() / 2] << "us"
+              << " p99=" << samples[samples.size() * 99 / 100] << "us"
+              << " calls/lookup=" << static_cast<double>(calls) / samples.size()
+              << " unwaited batches=" << windows.counts[0] << "/" << windows.total()
+              << " (threads=" << threads << ", n=" << samples.size() << ")" << std::endl;
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? std::atoi(argv[1]) : 32;
+    if (threads <= 0) {
+        threads = 32;
+    }
+    int lookups = argc > 2 ? std::atoi(argv[2]) : 50;
+    if (lookups <= 0) {
+        lookups = 50;
+    }
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::testing::FakeAscndService service;
+    service.read_delay_ms = 1;
+    for (int t = 0; t < threads; ++t) {
+        service.set_player_rank("leaderboard", "player-" + std::to_string(t), t + 1);
+    }
+    ascnd::testing::FakeServer server(&service);
+
+    ascnd::ClientConfig unbatched;
+    unbatched.server_address = server.address();
+    unbatched.api_key = "bench-key";
+    unbatched.use_ssl = false;
+    unbatched.max_retries = 0;
+
+    ascnd::ClientConfig fixed = unbatched;
+    fixed.player_rank_batch_window_ms = kWindowMs;
+
+    ascnd::ClientConfig adaptive = fixed;
+    adaptive.adaptive_batching = true;
+
+    bool ok = true;
+    const auto idle_pause = std::chrono::milliseconds(20);
+    ok = run("idle, unbatched", unbatched, service, 1, lookups, idle_pause) && ok;
+    ok = run("idle, fixed window", fixed, service, 1, lookups, idle_pause) && ok;
+    ok = run("idle, adaptive window", adaptive, service, 1, lookups, idle_pause) && ok;
+    ok = run("busy, unbatched", unbatched, service, threads, lookups, Clock::duration::zero()) && ok;
+    ok = run("busy, fixed window", fixed, service, threads, lookups, Clock::duration::zero()) && ok;
+    ok = run("busy, adaptive window", adaptive, service, threads, lookups, Clock::duration::zero()) && ok;
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,90 @@
+/**
+ * @file counter_bench.cpp
+ * @brief Cost of bumping client stats counters from 1 to 64 threads, with
+ *        one shared atomic per counter and with striped counters
+ *
+ * Usage: counter_bench [increments_per_thread]
+ *
+ * Reports core-nanoseconds per increment: wall time multiplied by the
+ * number of cores in use, divided by the increments made. Flat across
+ * thread counts means no contention.
+ */
+
+#include "striped_counters.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// The layout AscndClient::Impl used before striping: adjacent atomics
+struct SharedCounters {
+    std::atomic<uint64_t> values[9] = {};
+
+    void add(size_t counter) noexcept { values[counter].fetch_add(1, std::memory_order_relaxed); }
+    uint64_t sum(size_t counter) const noexcept { return values[counter].load(); }
+};
+
+// Each thread bumps a different counter of the set, as request threads do
+// when they hit different code paths, plus one counter all of them share
+template<typename Counters>
+double run(Counters& counters, int threads, int increments) {
+    std::atomic<bool> go{false};
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&counters, &go, t, increments]() {
+            while (!go.load()) {
+                std::this_thread::yield();
+            }
+            const size_t own = 1 + static_cast<size_t>(t) % 8;
+            for (int i = 0; i < increments; ++i) {
+                counters.add(0);
+                counters.add(own);
+            }
+        });
+    }
+
+    auto start = Clock::now();
+    go = true;
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed_ns = std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+
+    if (counters.sum(0) == 0) {
+        std::cerr << "no increments recorded" << std::endl;
+    }
+    const int cores = std::min<int>(threads, std::max(1u, std::thread::hardware_concurrency()));
+    return elapsed_ns * cores / (2.0 * threads * increments);
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int increments = argc > 1 ? std::atoi(argv[1]) : 1000000;
+    if (increments <= 0) {
+        increments = 1000000;
+    }
+
+    std::cout << "threads   shared atomics   striped counters   (core-ns per increment)" << std::endl;
+    for (int threads : {1, 2, 4, 8, 16, 32, 64}) {
+        auto shared = std::make_unique<SharedCounters>();
+        auto striped = std::make_unique<ascnd::StripedCounters<9>>();
+        double shared_ns = run(*shared, threads, increments);
+        double striped_ns = run(*striped, threads, increments);
+        std::cout << std::setw(7) << threads
+                  << std::setw(17) << std::fixed << std::setprecision(2) << shared_ns
+                  << std::setw(19) << striped_ns << std::endl;
+    }
+    return 0;
+}
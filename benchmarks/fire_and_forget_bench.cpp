@@ -0,0 +1,122 @@
+/**
+ * @file fire_and_forget_bench.cpp
+ * @brief Compares submit_score against submit_score_fire_and_forget when
+ *        responses carry anticheat violations
+ *
+ * Usage: fire_and_forget_bench [requests] [violations]
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <future>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void report(const std::string& label, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) {
+        sum += s;
+    }
+    std::cout << label
+              << ": mean=" << sum / samples.size() << "us"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " p99=" << samples[samples.size() * 99 / 100] << "us"
+              << " (n=" << samples.size() << ")" << std::endl;
+}
+
+ascnd::SubmitScoreRequest make_request() {
+    ascnd::SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(1000);
+    return request;
+}
+
+bool run_full(ascnd::AscndClient& client, int requests) {
+    auto request = make_request();
+    std::vector<double> samples;
+    samples.reserve(requests);
+    for (int i = 0; i < requests; ++i) {
+        auto start = Clock::now();
+        auto result = client.submit_score(request);
+        samples.push_back(to_us(Clock::now() - start));
+        if (!result) {
+            std::cerr << "submit_score failed: " << result.error() << std::endl;
+            return false;
+        }
+    }
+    report("submit_score", samples);
+    return true;
+}
+
+// Waits for each completion so that latencies are comparable
+bool run_fire_and_forget(ascnd::AscndClient& client, int requests) {
+    auto request = make_request();
+    std::vector<double> samples;
+    samples.reserve(requests);
+    for (int i = 0; i < requests; ++i) {
+        std::promise<int> done;
+        auto start = Clock::now();
+        client.submit_score_fire_and_forget(request, [&done](int error_code, const std::string&) {
+            done.set_value(error_code);
+        });
+        int error_code = done.get_future().get();
+        samples.push_back(to_us(Clock::now() - start));
+        if (error_code != 0) {
+            std::cerr << "submit_score_fire_and_forget failed with code " << error_code << std::endl;
+            return false;
+        }
+    }
+    report("submit_score_fire_and_forget", samples);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int requests = argc > 1 ? std::atoi(argv[1]) : 2000;
+    if (requests <= 0) {
+        requests = 2000;
+    }
+    int violations = argc > 2 ? std::atoi(argv[2]) : 20;
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::testing::FakeAscndService service;
+    service.anticheat_violations = violations;
+    ascnd::testing::FakeServer server(&service);
+
+    ascnd::ClientConfig config;
+    config.server_address = server.address();
+    config.api_key = "bench-key";
+    config.use_ssl = false;
+    config.max_retries = 0;
+    ascnd::AscndClient client(config);
+
+    // Warm up the connection before measuring
+    if (!client.submit_score(make_request())) {
+        std::cerr << "warm-up request failed" << std::endl;
+        return 1;
+    }
+
+    std::cout << "anticheat violations per response: " << violations << std::endl;
+    bool ok = run_full(client, requests);
+    ok = run_fire_and_forget(client, requests) && ok;
+    return ok ? 0 : 1;
+}
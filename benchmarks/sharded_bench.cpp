@@ -0,0 +1,122 @@
+/**
+ * @file sharded_bench.cpp
+ * @brief Compares many threads sharing one AscndClient against a
+ *        ShardedClient with a shard per thread
+ *
+ * Usage: sharded_bench [threads] [requests_per_thread]
+ */
+
+#include "ascnd/sharded_client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+// Runs requests_per_thread get_player_rank calls on each thread, using the
+// client client_for() returns on that thread
+bool run(const std::string& label, int threads, int requests_per_thread,
+         const std::function<ascnd::AscndClient&()>& client_for) {
+    std::mutex mutex;
+    std::vector<double> samples;
+    samples.reserve(static_cast<size_t>(threads) * requests_per_thread);
+    std::atomic<int> failures{0};
+
+    auto start = Clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&]() {
+            ascnd::AscndClient& client = client_for();
+            std::vector<double> local;
+            local.reserve(requests_per_thread);
+            for (int i = 0; i < requests_per_thread; ++i) {
+                auto request_start = Clock::now();
+                auto result = client.get_player_rank("leaderboard", "player");
+                local.push_back(to_us(Clock::now() - request_start));
+                if (!result) {
+                    ++failures;
+                }
+            }
+            std::lock_guard<std::mutex> lock(mutex);
+            samples.insert(samples.end(), local.begin(), local.end());
+        });
+    }
+    for (auto& worker : workers) {
+        worker.join();
+    }
+    double elapsed_s = to_us(Clock::now() - start) / 1e6;
+
+    if (failures > 0) {
+        std::cerr << label << ": " << failures << " requests failed" << std::endl;
+        return false;
+    }
+    std::sort(samples.begin(), samples.end());
+    std::cout << label
+              << ": " << static_cast<int>(samples.size() / elapsed_s) << " req/s"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " p99=" << samples[samples.size() * 99 / 100] << "us"
+              << " (threads=" << threads << ", n=" << samples.size() << ")" << std::endl;
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int threads = argc > 1 ? std::atoi(argv[1]) : 64;
+    if (threads <= 0) {
+        threads = 64;
+    }
+    int requests = argc > 2 ? std::atoi(argv[2]) : 200;
+    if (requests <= 0) {
+        requests = 200;
+    }
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::testing::FakeAscndService service;
+    ascnd::testing::FakeServer server(&service);
+
+    ascnd::ClientConfig config;
+    config.server_address = server.address();
+    config.api_key = "bench-key";
+    config.use_ssl = false;
+    config.max_retries = 0;
+
+    bool ok = true;
+    {
+        ascnd::AscndClient shared(config);
+        if (!shared.get_player_rank("leaderboard", "player")) {
+            std::cerr << "warm-up request failed" << std::endl;
+            return 1;
+        }
+        ok = run("shared client", threads, requests, [&]() -> ascnd::AscndClient& { return shared; }) && ok;
+    }
+    {
+        ascnd::ShardedClient sharded(config, static_cast<size_t>(threads));
+        for (size_t i = 0; i < sharded.shard_count(); ++i) {
+            if (!sharded.shard(i).get_player_rank("leaderboard", "player")) {
+                std::cerr << "warm-up request failed" << std::endl;
+                return 1;
+            }
+        }
+        ok = run("sharded client", threads, requests, [&]() -> ascnd::AscndClient& { return sharded.local(); }) && ok;
+    }
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,91 @@
+/**
+ * @file startup_bench.cpp
+ * @brief Measures client construction and construction-to-first-RPC time
+ *
+ * Usage: startup_bench [iterations]
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void report(const char* label, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) {
+        sum += s;
+    }
+    std::cout << label
+              << ": mean=" << sum / samples.size() << "us"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " max=" << samples.back() << "us"
+              << " (n=" << samples.size() << ")" << std::endl;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 50;
+    if (iterations <= 0) {
+        iterations = 50;
+    }
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::testing::FakeAscndService service;
+    ascnd::testing::FakeServer server(&service);
+
+    ascnd::ClientConfig config;
+    config.server_address = server.address();
+    config.api_key = "bench-key";
+    config.use_ssl = false;
+    config.max_retries = 0;
+
+    // First client in the process pays one-time runtime initialization
+    auto cold_start = Clock::now();
+    {
+        ascnd::AscndClient client(config);
+        auto result = client.get_player_rank("leaderboard", "player");
+        if (!result) {
+            std::cerr << "First RPC failed: " << result.error() << std::endl;
+            return 1;
+        }
+    }
+    std::cout << "cold construction-to-first-RPC: "
+              << to_us(Clock::now() - cold_start) << "us" << std::endl;
+
+    std::vector<double> construct_only;
+    std::vector<double> construct_to_rpc;
+    for (int i = 0; i < iterations; ++i) {
+        auto start = Clock::now();
+        ascnd::AscndClient client(config);
+        auto constructed = Clock::now();
+        auto result = client.get_player_rank("leaderboard", "player");
+        auto done = Clock::now();
+        if (!result) {
+            std::cerr << "RPC failed: " << result.error() << std::endl;
+            return 1;
+        }
+        construct_only.push_back(to_us(constructed - start));
+        construct_to_rpc.push_back(to_us(done - start));
+    }
+
+    report("construction", construct_only);
+    report("construction-to-first-RPC", construct_to_rpc);
+    return 0;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file tls_bench.cpp
+ * @brief Measures TLS reconnect cost with and without session resumption
+ *
+ * Each iteration creates a fresh client (and therefore a fresh connection)
+ * against a local TLS stand-in server and times construction-to-first-RPC.
+ *
+ * Usage: tls_bench [iterations]
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+#include "support/test_certs.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void report(const char* label, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) {
+        sum += s;
+    }
+    std::cout << label
+              << ": mean=" << sum / samples.size() << "us"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " max=" << samples.back() << "us"
+              << " (n=" << samples.size() << ")" << std::endl;
+}
+
+bool run(ascnd::ClientConfig config, int iterations, std::vector<double>& samples) {
+    for (int i = 0; i < iterations; ++i) {
+        auto start = Clock::now();
+        ascnd::AscndClient client(config);
+        auto result = client.get_player_rank("leaderboard", "player");
+        if (!result) {
+            std::cerr << "RPC failed: " << result.error() << std::endl;
+            return false;
+        }
+        samples.push_back(to_us(Clock::now() - start));
+    }
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int iterations = argc > 1 ? std::atoi(argv[1]) : 50;
+    if (iterations <= 0) {
+        iterations = 50;
+    }
+
+    // Trust the self-signed stand-in certificate via the default root store
+    std::string roots_path = "ascnd_tls_bench_roots.pem";
+    std::ofstream(roots_path) << ascnd::testing::kServerCertPem;
+#ifdef _WIN32
+    _putenv_s("GRPC_DEFAULT_SSL_ROOTS_FILE_PATH", roots_path.c_str());
+#else
+    setenv("GRPC_DEFAULT_SSL_ROOTS_FILE_PATH", roots_path.c_str(), 1);
+#endif
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    grpc::SslServerCredentialsOptions tls;
+    tls.pem_key_cert_pairs.push_back(
+        {ascnd::testing::kServerKeyPem, ascnd::testing::kServerCertPem});
+
+    ascnd::testing::FakeAscndService service;
+    ascnd::testing::FakeServer server(&service, grpc::SslServerCredentials(tls));
+
+    ascnd::ClientConfig config;
+    config.server_address = "localhost:" + std::to_string(server.port());
+    config.api_key = "bench-key";
+    config.use_ssl = true;
+    config.max_retries = 0;
+
+    std::vector<double> full;
+    config.tls_session_resumption = false;
+    bool ok = run(config, iterations, full);
+
+    std::vector<double> resumed;
+    config.tls_session_resumption = true;
+    ok = ok && run(config, iterations, resumed);
+
+    std::remove(roots_path.c_str());
+    if (!ok) {
+        return 1;
+    }
+
+    report("full handshake", full);
+    report("session resumption", resumed);
+    std::cout << "resumed calls observed by server: "
+              << service.resumed_session_calls.load() << std::endl;
+    return 0;
+}
@@ -0,0 +1,108 @@
+/**
+ * @file transport_bench.cpp
+ * @brief Compares request latency over loopback TCP, a Unix domain socket
+ *        and an in-process channel
+ *
+ * Usage: transport_bench [requests]
+ */
+
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+double to_us(Clock::duration d) {
+    return std::chrono::duration<double, std::micro>(d).count();
+}
+
+void report(const std::string& label, std::vector<double> samples) {
+    std::sort(samples.begin(), samples.end());
+    double sum = 0;
+    for (double s : samples) {
+        sum += s;
+    }
+    std::cout << label
+              << ": mean=" << sum / samples.size() << "us"
+              << " p50=" << samples[samples.size() / 2] << "us"
+              << " p99=" << samples[samples.size() * 99 / 100] << "us"
+              << " (n=" << samples.size() << ")" << std::endl;
+}
+
+bool run(const std::string& label, ascnd::AscndClient& client, int requests) {
+    // Warm up the connection before measuring
+    if (!client.get_player_rank("leaderboard", "player")) {
+        std::cerr << label << ": warm-up request failed" << std::endl;
+        return false;
+    }
+
+    std::vector<double> samples;
+    samples.reserve(requests);
+    for (int i = 0; i < requests; ++i) {
+        auto start = Clock::now();
+        auto result = client.get_player_rank("leaderboard", "player");
+        samples.push_back(to_us(Clock::now() - start));
+        if (!result) {
+            std::cerr << label << ": request failed: " << result.error() << std::endl;
+            return false;
+        }
+    }
+    report(label, samples);
+    return true;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    int requests = argc > 1 ? std::atoi(argv[1]) : 2000;
+    if (requests <= 0) {
+        requests = 2000;
+    }
+
+    ascnd::LoggingOptions logging;
+    logging.min_level = ascnd::LogLevel::kError;
+    ascnd::InitLogging(logging);
+
+    ascnd::ClientConfig config;
+    config.api_key = "bench-key";
+    config.use_ssl = false;
+    config.max_retries = 0;
+
+    ascnd::testing::FakeAscndService service;
+    bool ok = true;
+
+    {
+        ascnd::testing::FakeServer server(&service);
+        config.server_address = server.address();
+        ascnd::AscndClient client(config);
+        ok = run("loopback tcp", client, requests) && ok;
+
+        grpc::ChannelArguments args;
+        ascnd::AscndClient in_process(config, server.server()->InProcessChannel(args));
+        ok = run("in-process", in_process, requests) && ok;
+    }
+
+#ifndef _WIN32
+    {
+        std::string path = "ascnd_transport_bench.sock";
+        std::remove(path.c_str());
+        ascnd::testing::FakeServer server(&service, grpc::InsecureServerCredentials(),
+                                          "unix:" + path);
+        config.server_address = server.address();
+        ascnd::AscndClient client(config);
+        ok = run("unix socket", client, requests) && ok;
+        std::remove(path.c_str());
+    }
+#endif
+
+    return ok ? 0 : 1;
+}
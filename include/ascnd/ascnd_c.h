@@ -0,0 +1,275 @@
+#ifndef ASCND_ASCND_C_H
+#define ASCND_ASCND_C_H
+
+/**
+ * @file ascnd_c.h
+ * @brief C API for the Ascnd leaderboard client
+ *
+ * A stable C ABI over AscndClient for engine plugins and FFI bindings,
+ * provided by the ascnd_c shared library. Clients are opaque handles and
+ * requests complete through callbacks on a background thread.
+ *
+ * Results are handed to callbacks as read-only views into buffers owned by
+ * the library. Each response is decoded into the value types of
+ * ascnd/flat.hpp and the views point into those, with small arrays of entry
+ * and bracket views built for the call; no further copy is made for the
+ * caller. Every pointer stays valid until the callback returns. Copy
+ * anything needed later.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(_WIN32)
+#  if defined(ASCND_C_BUILDING)
+#    define ASCND_C_API __declspec(dllexport)
+#  else
+#    define ASCND_C_API __declspec(dllimport)
+#  endif
+#elif defined(__GNUC__)
+#  define ASCND_C_API __attribute__((visibility("default")))
+#else
+#  define ASCND_C_API
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ========================================================================== */
+/* Handles and Configuration                                                  */
+/* ========================================================================== */
+
+/** Opaque client handle */
+typedef struct ascnd_client ascnd_client;
+
+/**
+ * Client configuration. Initialize with ascnd_config_init(), then set
+ * fields. Fields are only ever appended; struct_size tells the library
+ * which ones the caller knows about.
+ */
+typedef struct ascnd_config {
+    /** sizeof(ascnd_config) as compiled by the caller (set by ascnd_config_init) */
+    size_t struct_size;
+
+    /**
+     * Server address, e.g. "api.ascnd.gg:443" (required). A
+     * "unix:/path/to/socket" address connects over a Unix domain socket.
+     */
+    const char* server_address;
+
+    /** API key sent with every request (required) */
+    const char* api_key;
+
+    /** Non-zero to use TLS (default: 1) */
+    int32_t use_ssl;
+
+    /** Request deadline in milliseconds (default: 10000) */
+    int32_t request_timeout_ms;
+
+    /** Retry attempts on transient failures (default: 3) */
+    int32_t max_retries;
+
+    /** Non-zero to multiplex requests over one Session stream (default: 0) */
+    int32_t session_mode;
+
+    /** Non-zero to resume TLS sessions across reconnects (default: 1) */
+    int32_t tls_session_resumption;
+
+    /** Connection timeout in milliseconds (default: 5000) */
+    int32_t connection_timeout_ms;
+
+    /** PEM root certificates to trust instead of the system roots (optional) */
+    const char* tls_root_certs_pem;
+
+    /** PEM client certificate chain for mutual TLS (optional) */
+    const char* tls_client_cert_pem;
+
+    /** PEM private key matching tls_client_cert_pem (optional) */
+    const char* tls_client_key_pem;
+
+    /**
+     * PEM server certificate to pin (optional): the connection is only
+     * accepted if the server presents exactly this certificate
+     */
+    const char* tls_pinned_server_cert_pem;
+} ascnd_config;
+
+/**
+ * Set the defaults of the fields covered by config->struct_size, leaving
+ * the rest untouched. Call ascnd_config_init() instead.
+ */
+ASCND_C_API void ascnd_config_defaults(ascnd_config* config);
+
+/**
+ * Fill a configuration with the defaults. Inline so that struct_size is
+ * the size the caller compiled, whichever library version it runs against.
+ */
+static inline void ascnd_config_init(ascnd_config* config) {
+    if (!config) {
+        return;
+    }
+    memset(config, 0, sizeof(*config));
+    config->struct_size = sizeof(*config);
+    ascnd_config_defaults(config);
+}
+
+/**
+ * Create a client.
+ * @return The client, or NULL if the configuration is invalid (see ascnd_last_error())
+ */
+ASCND_C_API ascnd_client* ascnd_client_create(const ascnd_config* config);
+
+/**
+ * Destroy a client. Blocks until every pending callback has returned, so
+ * it must not be called from a callback. NULL is ignored.
+ */
+ASCND_C_API void ascnd_client_destroy(ascnd_client* client);
+
+/**
+ * Message describing the last failed call on this thread. Valid until the
+ * next API call on the same thread; empty if none failed.
+ */
+ASCND_C_API const char* ascnd_last_error(void);
+
+/* ========================================================================== */
+/* Result Views                                                               */
+/* ========================================================================== */
+
+/** Borrowed string. data is NUL-terminated; size excludes the terminator. */
+typedef struct ascnd_string {
+    const char* data;
+    size_t size;
+} ascnd_string;
+
+typedef struct ascnd_bracket {
+    ascnd_string id;
+    ascnd_string name;
+    ascnd_string color; /**< Empty if the bracket has none */
+} ascnd_bracket;
+
+typedef struct ascnd_entry {
+    int64_t score;
+    int32_t rank;
+    int32_t bracket; /**< Index into ascnd_leaderboard.brackets, or -1 */
+    ascnd_string player_id;
+    ascnd_string submitted_at;
+    ascnd_string metadata;
+} ascnd_entry;
+
+typedef struct ascnd_leaderboard {
+    const ascnd_entry* entries;
+    size_t entry_count;
+    const ascnd_bracket* brackets;
+    size_t bracket_count;
+    int32_t total_entries;
+    int32_t has_more;
+    ascnd_string period_start;
+    ascnd_string period_end; /**< Empty for all-time leaderboards */
+    ascnd_string view_slug;  /**< Empty unless a view was queried */
+    ascnd_string view_name;
+} ascnd_leaderboard;
+
+typedef struct ascnd_player_rank {
+    int32_t has_rank; /**< Zero if the player has no score in the period */
+    int32_t rank;
+    int32_t has_score;
+    int64_t score;
+    int32_t has_best_score;
+    int64_t best_score;
+    int32_t total_entries;
+    ascnd_string percentile;
+    const ascnd_bracket* bracket; /**< NULL if the player has no bracket */
+    ascnd_string view_slug;
+    ascnd_string view_name;
+    int32_t has_global_rank; /**< View queries only */
+    int32_t global_rank;
+    int32_t global_total_entries;
+    ascnd_string global_percentile;
+} ascnd_player_rank;
+
+typedef struct ascnd_violation {
+    ascnd_string flag_type;
+    ascnd_string reason;
+} ascnd_violation;
+
+typedef struct ascnd_submit_result {
+    ascnd_string score_id;
+    int32_t rank;
+    int32_t is_new_best;
+    int32_t was_deduplicated;
+    int32_t anticheat_passed; /**< 1 if the server reported no violations */
+    ascnd_string anticheat_action;
+    const ascnd_violation* violations;
+    size_t violation_count;
+} ascnd_submit_result;
+
+/* ========================================================================== */
+/* Requests                                                                   */
+/* ========================================================================== */
+
+typedef struct ascnd_submission {
+    const char* leaderboard_id;
+    const char* player_id;
+    int64_t score;
+    const char* metadata; /**< Optional, metadata_size bytes */
+    size_t metadata_size;
+    const char* idempotency_key; /**< Optional */
+} ascnd_submission;
+
+typedef struct ascnd_leaderboard_query {
+    const char* leaderboard_id;
+    int32_t limit;  /**< 0 for the server default */
+    int32_t offset;
+    const char* period;    /**< Optional */
+    const char* view_slug; /**< Optional */
+} ascnd_leaderboard_query;
+
+typedef struct ascnd_player_rank_query {
+    const char* leaderboard_id;
+    const char* player_id;
+    const char* period;    /**< Optional */
+    const char* view_slug; /**< Optional */
+} ascnd_player_rank_query;
+
+/*
+ * Completion callbacks run on a background thread. On failure result is
+ * NULL, error_code holds the gRPC status code and error_message describes
+ * it; on success error_message is empty. Failures detected locally use the
+ * matching code: INVALID_ARGUMENT (3) for submissions rejected by local
+ * validation and RESOURCE_EXHAUSTED (8) for throttled ones.
+ */
+typedef void (*ascnd_submit_callback)(void* user_data, int32_t error_code, const char* error_message,
+                                      const ascnd_submit_result* result);
+typedef void (*ascnd_leaderboard_callback)(void* user_data, int32_t error_code, const char* error_message,
+                                           const ascnd_leaderboard* result);
+typedef void (*ascnd_player_rank_callback)(void* user_data, int32_t error_code, const char* error_message,
+                                           const ascnd_player_rank* result);
+
+/**
+ * Submit a score. Request strings are copied before returning.
+ * @return 0 if the request was started, -1 on invalid arguments (see ascnd_last_error())
+ */
+ASCND_C_API int ascnd_submit_score(ascnd_client* client, const ascnd_submission* submission,
+                                   ascnd_submit_callback callback, void* user_data);
+
+/**
+ * Get a page of leaderboard entries.
+ * @return 0 if the request was started, -1 on invalid arguments (see ascnd_last_error())
+ */
+ASCND_C_API int ascnd_get_leaderboard(ascnd_client* client, const ascnd_leaderboard_query* query,
+                                      ascnd_leaderboard_callback callback, void* user_data);
+
+/**
+ * Get a player's rank.
+ * @return 0 if the request was started, -1 on invalid arguments (see ascnd_last_error())
+ */
+ASCND_C_API int ascnd_get_player_rank(ascnd_client* client, const ascnd_player_rank_query* query,
+                                      ascnd_player_rank_callback callback, void* user_data);
+
+#ifdef __cplusplus
+}  /* extern "C" */
+#endif
+
+#endif  /* ASCND_ASCND_C_H */
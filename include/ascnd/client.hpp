@@ -8,18 +8,28 @@
  * Designed for use in game engines like Unreal Engine and custom game projects.
  */
 
+#include "export.hpp"
 #include "types.hpp"
-#include "ascnd.grpc.pb.h"
+#include "flat.hpp"
+#include "score_stream.hpp"
+#include "rank_watcher.hpp"
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
 #include <string>
 #include <memory>
 #include <mutex>
 #include <functional>
 #include <chrono>
 #include <future>
+#include <optional>
 #include <stdexcept>
+#include <vector>
 
-#include <grpcpp/grpcpp.h>
+namespace grpc {
+class Channel;
+}  // namespace grpc
 
 namespace ascnd {
 
@@ -81,7 +91,7 @@ struct LoggingOptions {
  * ascnd::AscndClient client(config);
  * @endcode
  */
-void InitLogging(const LoggingOptions& options = LoggingOptions{});
+ASCND_API void InitLogging(const LoggingOptions& options = LoggingOptions{});
 
 /**
  * @brief Shutdown logging
@@ -89,17 +99,83 @@ void InitLogging(const LoggingOptions& options = LoggingOptions{});
  * Call this before program exit to flush log buffers.
  * Safe to call multiple times.
  */
-void ShutdownLogging();
+ASCND_API void ShutdownLogging();
 
 // ============================================================================
 // Client Configuration
 // ============================================================================
 
+/**
+ * @brief How submissions are checked against a leaderboard's rules
+ *
+ * The rules (score bounds, velocity limit, idempotency key requirement) are
+ * fetched with GetLeaderboardRules on first use and cached.
+ */
+enum class LocalValidation {
+    kOff = 0,    ///< Send submissions unchecked
+    kFlag = 1,   ///< Log and count violations, but send anyway
+    kReject = 2  ///< Fail violating submissions locally without sending them
+};
+
+/**
+ * @brief What happens to submissions over a player's submission limit
+ */
+enum class ThrottleMode {
+    kDelay = 0,  ///< Wait until the window has room (up to request_timeout_ms)
+    kReject = 1  ///< Fail with RESOURCE_EXHAUSTED without sending
+};
+
+/**
+ * @brief Handling of submissions that cannot beat the player's best score
+ *
+ * A submission is non-improving if the player is known to have reached an
+ * equal or better score in the leaderboard's current period, either from an
+ * earlier submission or from get_player_rank(). Such submissions are still
+ * throttled and validated locally, then succeed immediately with an empty
+ * response (is_new_best false, no score_id or rank). The leaderboard's sort
+ * order and period come from its rules (see get_leaderboard_rules());
+ * without them nothing is filtered.
+ *
+ * In kBatch mode, a batch that fails with a transient error is sent again
+ * after best_score_batch_delay_ms, up to three times in all; submissions
+ * still not accepted are counted in ClientStats::submissions_lost. A
+ * deferred fire-and-forget submission's callback receives its real outcome
+ * once the batch has been sent.
+ */
+enum class BestScoreFilter {
+    kOff = 0,   ///< Send every submission
+    kSkip = 1,  ///< Drop non-improving submissions
+    kBatch = 2  ///< Send non-improving submissions later, in one SubmitScoreBatch call
+};
+
+/**
+ * @brief CPUs a group of client threads may run on
+ *
+ * The CPUs listed and those of the NUMA nodes listed are combined. Empty
+ * leaves scheduling to the OS. Pinning is Linux-only and best effort:
+ * elsewhere, or if the set is unusable, a warning is logged and threads
+ * run unpinned.
+ *
+ * A thread pinned to one node also allocates its buffers there, since Linux
+ * places memory on the node of the thread that first touches it.
+ */
+struct ThreadAffinity {
+    /// CPU numbers as the OS counts them (see /proc/cpuinfo)
+    std::vector<int> cpus;
+
+    /// NUMA nodes whose CPUs are added (see /sys/devices/system/node)
+    std::vector<int> numa_nodes;
+
+    [[nodiscard]] bool empty() const { return cpus.empty() && numa_nodes.empty(); }
+};
+
 /**
  * @brief Configuration options for AscndClient
  */
 struct ClientConfig {
-    /// gRPC server address (e.g., "api.ascnd.gg:443")
+    /// gRPC server address (e.g., "api.ascnd.gg:443"). Unix domain sockets
+    /// ("unix:/run/ascnd.sock", "unix-abstract:ascnd") are supported for
+    /// same-host sidecars and always use a plaintext connection.
     std::string server_address;
 
     /// API key for authentication (sent as metadata)
@@ -108,6 +184,25 @@ struct ClientConfig {
     /// Whether to use SSL/TLS (default: true)
     bool use_ssl = true;
 
+    /// Resume TLS sessions from a process-wide ticket cache so reconnects
+    /// and additional clients skip the full handshake (default: true)
+    bool tls_session_resumption = true;
+
+    /// PEM-encoded root certificates to trust instead of the system roots (optional)
+    std::string tls_root_certs_pem;
+
+    /// PEM-encoded client certificate chain for mutual TLS (optional)
+    std::string tls_client_cert_pem;
+
+    /// PEM-encoded private key matching tls_client_cert_pem (optional)
+    std::string tls_client_key_pem;
+
+    /// PEM-encoded server certificate to pin (optional). When set, the
+    /// connection is only accepted if the server presents exactly this
+    /// certificate; CA verification additionally applies if
+    /// tls_root_certs_pem is set.
+    std::string tls_pinned_server_cert_pem;
+
     /// Connection timeout in milliseconds (default: 5000)
     int connection_timeout_ms = 5000;
 
@@ -120,12 +215,93 @@ struct ClientConfig {
     /// Base delay between retries in milliseconds (exponential backoff)
     int retry_delay_ms = 100;
 
+    /// Carry submit_score, get_leaderboard and get_player_rank over one
+    /// multiplexed Session stream instead of a call each. Concurrent requests
+    /// are pipelined and may complete out of order. Falls back to unary calls
+    /// if the server does not support sessions (default: false)
+    bool session_mode = false;
+
+    /// Check submit_score and submit_score_fire_and_forget submissions against
+    /// the leaderboard's cached rules before sending (default: kOff)
+    LocalValidation local_validation = LocalValidation::kOff;
+
+    /// How long fetched leaderboard rules are cached, in milliseconds, when
+    /// the server does not specify a lifetime (default: 300000)
+    int rules_cache_ttl_ms = 300000;
+
+    /// Most submit_score and submit_score_fire_and_forget submissions per
+    /// player and leaderboard within player_submission_window_ms. Bursts
+    /// beyond it are delayed or rejected per player_throttle_mode before
+    /// reaching the network. 0 disables throttling (default: 0)
+    int player_submission_limit = 0;
+
+    /// Length of the sliding window for player_submission_limit in
+    /// milliseconds (default: 1000)
+    int player_submission_window_ms = 1000;
+
+    /// Handling of submissions over player_submission_limit (default: kDelay)
+    ThrottleMode player_throttle_mode = ThrottleMode::kDelay;
+
+    /// Skip or batch submit_score and submit_score_fire_and_forget
+    /// submissions that cannot beat the player's best score (default: kOff)
+    BestScoreFilter best_score_filter = BestScoreFilter::kOff;
+
+    /// How long non-improving submissions are held before being sent as a
+    /// batch, in milliseconds (BestScoreFilter::kBatch, default: 1000)
+    int best_score_batch_delay_ms = 1000;
+
+    /// Reuse get_player_rank responses for this many milliseconds. Besides
+    /// identical requests, a request without a view_slug is answered from a
+    /// recent response for the same player in any view, which carries the
+    /// global rank as well. A player's responses are dropped when they
+    /// submit a score through submit_score, its async and fire-and-forget
+    /// forms or submit_score_batch; submissions over a ScoreStream do not
+    /// drop them. 0 disables reuse (default: 0)
+    int player_rank_cache_ms = 0;
+
+    /// Collect get_player_rank calls for the same leaderboard, period and
+    /// view that arrive within this many milliseconds of the first, and send
+    /// them as one GetPlayerRanks call. The first call waits out the window;
+    /// later ones wait less. Falls back to single calls if the server does
+    /// not support GetPlayerRanks. 0 disables batching (default: 0)
+    int player_rank_batch_window_ms = 0;
+
+    /// Size the best_score_batch_delay_ms and player_rank_batch_window_ms
+    /// windows from recent traffic, treating them as upper bounds: a request
+    /// is sent at once when no other is expected before the window would
+    /// close, and otherwise waits up to the recent batch call latency
+    /// (default: false)
+    bool adaptive_batching = false;
+
+    /// Open a connection of this client's own. By default, clients with
+    /// identical settings share one connection to the server (default: false)
+    bool dedicated_connection = false;
+
+    /// CPUs for the threads that run async requests and their callbacks,
+    /// and for deferred batch flushes. Each thread is pinned before it sends
+    /// its request and allocates the response (default: unpinned)
+    ThreadAffinity callback_thread_affinity;
+
+    /// CPUs for the gRPC threads that complete fire-and-forget and session
+    /// calls, pinned the first time they run this client's completion code.
+    /// These threads are shared by every gRPC user in the process, so give
+    /// all clients the same set (default: unpinned)
+    ThreadAffinity completion_thread_affinity;
+
     /// Custom User-Agent string (optional)
     std::string user_agent;
 
     /// Enable verbose logging (default: false)
     bool verbose = false;
 
+    /**
+     * @brief Whether server_address refers to a Unix domain socket
+     */
+    [[nodiscard]] bool is_unix_socket() const {
+        return server_address.rfind("unix:", 0) == 0 ||
+               server_address.rfind("unix-abstract:", 0) == 0;
+    }
+
     /**
      * @brief Validate the configuration
      * @throws std::invalid_argument if configuration is invalid
@@ -146,6 +322,164 @@ struct ClientConfig {
         if (retry_delay_ms < 0) {
             throw std::invalid_argument("retry_delay_ms cannot be negative");
         }
+        if (rules_cache_ttl_ms <= 0) {
+            throw std::invalid_argument("rules_cache_ttl_ms must be positive");
+        }
+        if (player_submission_limit < 0) {
+            throw std::invalid_argument("player_submission_limit cannot be negative");
+        }
+        if (player_submission_window_ms <= 0) {
+            throw std::invalid_argument("player_submission_window_ms must be positive");
+        }
+        if (best_score_batch_delay_ms <= 0) {
+            throw std::invalid_argument("best_score_batch_delay_ms must be positive");
+        }
+        if (player_rank_cache_ms < 0) {
+            throw std::invalid_argument("player_rank_cache_ms cannot be negative");
+        }
+        if (player_rank_batch_window_ms < 0) {
+            throw std::invalid_argument("player_rank_batch_window_ms cannot be negative");
+        }
+        for (const ThreadAffinity* affinity : {&callback_thread_affinity, &completion_thread_affinity}) {
+            for (int cpu : affinity->cpus) {
+                if (cpu < 0) {
+                    throw std::invalid_argument("thread affinity CPUs cannot be negative");
+                }
+            }
+            for (int node : affinity->numa_nodes) {
+                if (node < 0) {
+                    throw std::invalid_argument("thread affinity NUMA nodes cannot be negative");
+                }
+            }
+        }
+        if (tls_client_cert_pem.empty() != tls_client_key_pem.empty()) {
+            throw std::invalid_argument(
+                "tls_client_cert_pem and tls_client_key_pem must be set together");
+        }
+        bool has_tls_options = !tls_root_certs_pem.empty() || !tls_client_cert_pem.empty() ||
+                               !tls_pinned_server_cert_pem.empty();
+        if (has_tls_options && !use_ssl && !is_unix_socket()) {
+            throw std::invalid_argument("TLS certificate options require use_ssl");
+        }
+    }
+};
+
+/**
+ * @brief Create the channel an AscndClient with this configuration would use
+ *
+ * Applies the transport settings of the configuration: TLS credentials
+ * (custom roots, mutual TLS, certificate pinning), TLS session resumption,
+ * user_agent and dedicated_connection. Credentials are shared with every
+ * client using the same TLS settings. The configuration is not validated
+ * and request settings such as api_key are ignored.
+ *
+ * @param config Client configuration
+ * @return A channel to config.server_address
+ */
+ASCND_API std::shared_ptr<grpc::Channel> CreateChannel(const ClientConfig& config);
+
+/**
+ * @brief Batch counts by power-of-two bucket of window or size
+ */
+struct BatchHistogram {
+    static constexpr size_t kBuckets = 12;
+
+    /// In a window histogram, bucket 0 counts batches sent without waiting
+    /// and bucket i windows of 2^(i-2) ms up to 2^(i-1) ms, bucket 1 being
+    /// under 1 ms. In a size histogram, bucket i counts batches of 2^i up to
+    /// 2^(i+1) - 1 requests. The last bucket is open-ended.
+    std::array<uint64_t, kBuckets> counts{};
+
+    /// Batches counted in all buckets
+    [[nodiscard]] uint64_t total() const {
+        uint64_t sum = 0;
+        for (uint64_t count : counts) {
+            sum += count;
+        }
+        return sum;
+    }
+
+    BatchHistogram& operator+=(const BatchHistogram& other) {
+        for (size_t i = 0; i < kBuckets; ++i) {
+            counts[i] += other.counts[i];
+        }
+        return *this;
+    }
+};
+
+/**
+ * @brief Counters describing a client's activity since construction
+ */
+struct ClientStats {
+    /// Submissions failed locally because they broke the leaderboard's rules
+    uint64_t submissions_rejected_locally = 0;
+
+    /// Submissions sent although they broke the leaderboard's rules
+    /// (LocalValidation::kFlag)
+    uint64_t submissions_flagged_locally = 0;
+
+    /// Submissions held back until the player's submission window had room
+    uint64_t submissions_delayed = 0;
+
+    /// Submissions failed locally because the player's submission window
+    /// was full (ThrottleMode::kReject, or a delay beyond the request timeout)
+    uint64_t submissions_throttled = 0;
+
+    /// Non-improving submissions dropped (BestScoreFilter::kSkip)
+    uint64_t submissions_skipped = 0;
+
+    /// Non-improving submissions deferred to a batch (BestScoreFilter::kBatch)
+    uint64_t submissions_batched = 0;
+
+    /// Deferred submissions the server did not accept, after retrying
+    /// batches that failed with a transient error
+    uint64_t submissions_lost = 0;
+
+    /// get_player_rank calls answered from a recent response
+    /// (ClientConfig::player_rank_cache_ms)
+    uint64_t player_rank_cache_hits = 0;
+
+    /// GetPlayerRanks calls sent for coalesced get_player_rank calls
+    /// (ClientConfig::player_rank_batch_window_ms)
+    uint64_t player_rank_batches = 0;
+
+    /// get_player_rank calls carried by those GetPlayerRanks calls
+    uint64_t player_ranks_batched = 0;
+
+    /// RPCs sent to the server, counting each retry attempt
+    uint64_t requests_sent = 0;
+
+    /// Requests that failed after all retries
+    uint64_t requests_failed = 0;
+
+    /// Windows chosen and lookups sent per call by get_player_rank batching
+    BatchHistogram rank_batch_windows;
+    BatchHistogram rank_batch_sizes;
+
+    /// Windows chosen and submissions sent per SubmitScoreBatch call for
+    /// deferred submissions (BestScoreFilter::kBatch)
+    BatchHistogram submit_batch_windows;
+    BatchHistogram submit_batch_sizes;
+
+    /// Add another client's counters, e.g. to total several clients
+    ClientStats& operator+=(const ClientStats& other) {
+        submissions_rejected_locally += other.submissions_rejected_locally;
+        submissions_flagged_locally += other.submissions_flagged_locally;
+        submissions_delayed += other.submissions_delayed;
+        submissions_throttled += other.submissions_throttled;
+        submissions_skipped += other.submissions_skipped;
+        submissions_batched += other.submissions_batched;
+        submissions_lost += other.submissions_lost;
+        player_rank_cache_hits += other.player_rank_cache_hits;
+        player_rank_batches += other.player_rank_batches;
+        player_ranks_batched += other.player_ranks_batched;
+        requests_sent += other.requests_sent;
+        requests_failed += other.requests_failed;
+        rank_batch_windows += other.rank_batch_windows;
+        rank_batch_sizes += other.rank_batch_sizes;
+        submit_batch_windows += other.submit_batch_windows;
+        submit_batch_sizes += other.submit_batch_sizes;
+        return *this;
     }
 };
 
@@ -155,6 +489,14 @@ struct ClientConfig {
 template<typename T>
 using AsyncCallback = std::function<void(Result<T>)>;
 
+/**
+ * @brief Callback type for operations without a response body
+ *
+ * Receives 0 and an empty message on success, or the gRPC status code and
+ * error message on failure.
+ */
+using StatusCallback = std::function<void(int error_code, const std::string& error_message)>;
+
 /**
  * @brief Thread-safe gRPC client for the Ascnd leaderboard API
  *
@@ -181,7 +523,7 @@ using AsyncCallback = std::function<void(Result<T>)>;
  * }
  * @endcode
  */
-class AscndClient {
+class ASCND_API AscndClient {
 public:
     /**
      * @brief Construct a client with the given configuration
@@ -196,6 +538,19 @@ public:
      */
     AscndClient(const std::string& server_address, const std::string& api_key);
 
+    /**
+     * @brief Construct a client over an existing channel
+     *
+     * Intended for in-process transports such as
+     * grpc::Server::InProcessChannel() in tests. The channel is used as is:
+     * SSL and user_agent settings do not apply, and server_address is only
+     * used for logging (it defaults to "in-process" when empty).
+     *
+     * @param config Client configuration
+     * @param channel Channel to issue requests on
+     */
+    AscndClient(ClientConfig config, std::shared_ptr<grpc::Channel> channel);
+
     /**
      * @brief Destructor - blocks until all pending async operations complete
      *
@@ -238,6 +593,26 @@ public:
      */
     Result<GetPlayerRankResponse> get_player_rank(const GetPlayerRankRequest& request);
 
+    /**
+     * @brief Submit several scores in a single request
+     * @param request Submissions to record, processed in order
+     * @return Result containing one result per submission, or an error if
+     *         the batch as a whole failed
+     */
+    Result<SubmitScoreBatchResponse> submit_score_batch(const SubmitScoreBatchRequest& request);
+
+    /**
+     * @brief Get the anticheat rules of a leaderboard
+     *
+     * Always asks the server and refreshes the rules cached for local
+     * validation. Call it at startup to keep the first submission to each
+     * leaderboard from waiting for the fetch.
+     *
+     * @param request Leaderboard to get rules for
+     * @return Result containing the leaderboard's rules or error
+     */
+    Result<GetLeaderboardRulesResponse> get_leaderboard_rules(const GetLeaderboardRulesRequest& request);
+
     // ========================================================================
     // Convenience Methods
     // ========================================================================
@@ -311,6 +686,15 @@ public:
         const GetPlayerRankRequest& request
     );
 
+    /**
+     * @brief Submit several scores asynchronously
+     * @param request Submissions to record, processed in order
+     * @return Future that will contain the result when complete
+     */
+    [[nodiscard]] std::future<Result<SubmitScoreBatchResponse>> submit_score_batch_async(
+        const SubmitScoreBatchRequest& request
+    );
+
     // ========================================================================
     // Asynchronous API (Callback-based)
     // ========================================================================
@@ -348,6 +732,133 @@ public:
         AsyncCallback<GetPlayerRankResponse> callback
     );
 
+    /**
+     * @brief Submit several scores asynchronously with callback
+     * @param request Submissions to record, processed in order
+     * @param callback Callback to invoke with the result
+     */
+    void submit_score_batch_async(
+        const SubmitScoreBatchRequest& request,
+        AsyncCallback<SubmitScoreBatchResponse> callback
+    );
+
+    /**
+     * @brief Submit a score without waiting for or parsing the response
+     * @param request Score submission details
+     * @param callback Optional callback receiving the call's status
+     *
+     * Asks the server to omit the response body and never deserializes one,
+     * so rank and anticheat results are not available. The call is not
+     * retried; use an idempotency key and resubmit from the callback if
+     * delivery matters. Always issued as a unary call, even in session mode.
+     *
+     * Never blocks the calling thread. A submission over the player's
+     * submission limit fails at once with RESOURCE_EXHAUSTED, even with
+     * ThrottleMode::kDelay. If the leaderboard's rules are not cached yet,
+     * they are fetched in the background and this submission goes out
+     * without local validation or best score filtering.
+     *
+     * @note The callback is invoked on a gRPC thread, or on the calling
+     *       thread for submissions handled locally. Keep it short and
+     *       non-blocking.
+     */
+    void submit_score_fire_and_forget(
+        const SubmitScoreRequest& request,
+        StatusCallback callback = nullptr
+    );
+
+    // ========================================================================
+    // Flat Value API
+    // ========================================================================
+
+    /**
+     * @brief Submit a score using plain value types
+     *
+     * Behaves like submit_score(const SubmitScoreRequest&); the submission
+     * is converted to the wire message and the response converted back.
+     *
+     * @param submission Score submission details
+     * @return Result containing the submission outcome or error
+     */
+    Result<flat::SubmitResult> submit_score(const flat::ScoreSubmission& submission);
+
+    /**
+     * @brief Get leaderboard entries as plain value types
+     *
+     * Entries reference their bracket by index into the page's bracket list.
+     *
+     * @param query Leaderboard query parameters
+     * @return Result containing the leaderboard page or error
+     */
+    Result<flat::Leaderboard> get_leaderboard(const flat::LeaderboardQuery& query);
+
+    /**
+     * @brief Get a player's rank as a plain value type
+     * @param query Player rank query parameters
+     * @return Result containing the player's rank info or error
+     */
+    Result<flat::PlayerRank> get_player_rank(const flat::PlayerRankQuery& query);
+
+    /**
+     * @brief Submit a score asynchronously using plain value types
+     * @param submission Score submission details
+     * @param callback Callback to invoke with the result
+     */
+    void submit_score_async(
+        const flat::ScoreSubmission& submission,
+        AsyncCallback<flat::SubmitResult> callback
+    );
+
+    /**
+     * @brief Get leaderboard entries asynchronously as plain value types
+     * @param query Leaderboard query parameters
+     * @param callback Callback to invoke with the result
+     */
+    void get_leaderboard_async(
+        const flat::LeaderboardQuery& query,
+        AsyncCallback<flat::Leaderboard> callback
+    );
+
+    /**
+     * @brief Get a player's rank asynchronously as a plain value type
+     * @param query Player rank query parameters
+     * @param callback Callback to invoke with the result
+     */
+    void get_player_rank_async(
+        const flat::PlayerRankQuery& query,
+        AsyncCallback<flat::PlayerRank> callback
+    );
+
+    // ========================================================================
+    // Streaming API
+    // ========================================================================
+
+    /**
+     * @brief Open a long-lived score submission stream
+     * @param callback Invoked once per written submission with its outcome
+     * @param options Stream flow-control options
+     * @return Open stream; writes are acknowledged through the callback
+     *
+     * Submissions written to the stream share one RPC, so they skip the
+     * per-call setup and retry logic of submit_score(). A stream that fails
+     * reports every outstanding submission to the callback as an error and
+     * must be reopened by the caller.
+     */
+    [[nodiscard]] std::unique_ptr<ScoreStream> open_score_stream(
+        ScoreAckCallback callback,
+        ScoreStreamOptions options = {}
+    );
+
+    /**
+     * @brief Open a stream of rank change events for tracked players
+     * @param callback Invoked for each rank change of a watched player
+     * @return Open watcher; add and remove players with watch()/unwatch()
+     *
+     * One watcher replaces polling get_player_rank() for every online
+     * player. A watcher whose stream fails must be reopened by the caller.
+     */
+    [[nodiscard]] std::unique_ptr<RankWatcher> watch_player_ranks(RankChangeCallback callback);
+
     // ========================================================================
     // Configuration
     // ========================================================================
@@ -364,6 +875,26 @@ public:
      */
     [[nodiscard]] ClientConfig config() const;
 
+    /**
+     * @brief Look up a metadata view seen in an earlier response
+     *
+     * Views are remembered from get_leaderboard() and get_player_rank()
+     * responses, so their display names are available without a request.
+     *
+     * @param leaderboard_id Leaderboard identifier
+     * @param view_slug View slug
+     * @return The view, or std::nullopt if no response carried it yet
+     */
+    [[nodiscard]] std::optional<ViewInfo> cached_view(
+        const std::string& leaderboard_id,
+        const std::string& view_slug
+    ) const;
+
+    /**
+     * @brief Get a snapshot of the client's activity counters
+     */
+    [[nodiscard]] ClientStats stats() const;
+
     /**
      * @brief Test connectivity to the API
      * @return true if the gRPC channel is ready
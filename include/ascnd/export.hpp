@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file export.hpp
+ * @brief Symbol export macro for shared library builds
+ *
+ * A shared ascnd-client (ASCND_BUILD_SHARED) is compiled with hidden
+ * visibility; ASCND_API marks the classes and functions it exports.
+ * ASCND_SHARED is defined for consumers by the CMake target.
+ */
+
+#if defined(ASCND_SHARED)
+#  if defined(_WIN32)
+#    if defined(ASCND_BUILDING)
+#      define ASCND_API __declspec(dllexport)
+#    else
+#      define ASCND_API __declspec(dllimport)
+#    endif
+#  else
+#    define ASCND_API __attribute__((visibility("default")))
+#  endif
+#else
+#  define ASCND_API
+#endif
@@ -0,0 +1,274 @@
+#pragma once
+
+/**
+ * @file flat.hpp
+ * @brief Plain C++ value types for the Ascnd leaderboard API
+ *
+ * SDK-owned alternatives to the protobuf messages in types.hpp. They are
+ * ordinary structs with value semantics: entries are stored contiguously,
+ * IDs up to Id::kInlineCapacity characters live inline, and nothing here
+ * depends on protobuf or gRPC headers. AscndClient converts to and from the
+ * wire messages when a request is sent and a response arrives.
+ */
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ascnd {
+namespace flat {
+
+// ============================================================================
+// Identifiers
+// ============================================================================
+
+/**
+ * @brief Immutable identifier string with inline storage
+ *
+ * IDs of up to kInlineCapacity characters (e.g. UUIDs) are stored inside
+ * the object, so copying or sorting entries does not touch the heap.
+ * Longer IDs fall back to a heap allocation.
+ */
+class Id {
+public:
+    /// Longest ID stored without allocating
+    static constexpr size_t kInlineCapacity = 39;
+
+    Id() noexcept { inline_[0] = '\0'; }
+    Id(std::string_view text) { assign(text); }
+    Id(const std::string& text) { assign(text); }
+    Id(const char* text) { assign(text); }
+
+    Id(const Id& other) { assign(other.view()); }
+    Id(Id&& other) noexcept { steal(other); }
+
+    /// Copy and move assignment
+    Id& operator=(Id other) noexcept {
+        release();
+        steal(other);
+        return *this;
+    }
+
+    ~Id() { release(); }
+
+    [[nodiscard]] const char* data() const noexcept { return on_heap() ? heap_ : inline_; }
+    [[nodiscard]] const char* c_str() const noexcept { return data(); }
+    [[nodiscard]] size_t size() const noexcept { return size_; }
+    [[nodiscard]] bool empty() const noexcept { return size_ == 0; }
+
+    [[nodiscard]] std::string_view view() const noexcept { return {data(), size_}; }
+    [[nodiscard]] std::string str() const { return std::string(data(), size_); }
+    operator std::string_view() const noexcept { return view(); }
+
+    friend bool operator==(const Id& a, const Id& b) noexcept { return a.view() == b.view(); }
+    friend bool operator!=(const Id& a, const Id& b) noexcept { return a.view() != b.view(); }
+    friend bool operator<(const Id& a, const Id& b) noexcept { return a.view() < b.view(); }
+
+private:
+    bool on_heap() const noexcept { return size_ > kInlineCapacity; }
+
+    void assign(std::string_view text) {
+        size_ = static_cast<uint32_t>(text.size());
+        char* buffer = inline_;
+        if (on_heap()) {
+            heap_ = new char[size_ + 1];
+            buffer = heap_;
+        }
+        std::memcpy(buffer, text.data(), size_);
+        buffer[size_] = '\0';
+    }
+
+    // Takes other's contents, leaving it empty; *this must hold nothing
+    void steal(Id& other) noexcept {
+        size_ = other.size_;
+        if (other.on_heap()) {
+            heap_ = other.heap_;
+        } else {
+            std::memcpy(inline_, other.inline_, size_ + 1);
+        }
+        other.size_ = 0;
+        other.inline_[0] = '\0';
+    }
+
+    void release() noexcept {
+        if (on_heap()) {
+            delete[] heap_;
+        }
+        size_ = 0;
+        inline_[0] = '\0';
+    }
+
+    uint32_t size_ = 0;
+    union {
+        char inline_[kInlineCapacity + 1];
+        char* heap_;
+    };
+};
+
+// ============================================================================
+// Requests
+// ============================================================================
+
+/**
+ * @brief A score submission (see SubmitScoreRequest)
+ */
+struct ScoreSubmission {
+    Id leaderboard_id;
+    Id player_id;
+    int64_t score = 0;
+
+    /// Opaque metadata stored with the score
+    std::optional<std::string> metadata;
+
+    /// Key the server deduplicates retried submissions by
+    std::optional<std::string> idempotency_key;
+};
+
+/**
+ * @brief A leaderboard page query (see GetLeaderboardRequest)
+ */
+struct LeaderboardQuery {
+    Id leaderboard_id;
+    std::optional<int32_t> limit;
+    std::optional<int32_t> offset;
+    std::optional<std::string> period;
+    std::optional<std::string> view_slug;
+};
+
+/**
+ * @brief A player rank query (see GetPlayerRankRequest)
+ */
+struct PlayerRankQuery {
+    Id leaderboard_id;
+    Id player_id;
+    std::optional<std::string> period;
+    std::optional<std::string> view_slug;
+};
+
+// ============================================================================
+// Responses
+// ============================================================================
+
+/**
+ * @brief Bracket (tier) of a leaderboard position
+ */
+struct Bracket {
+    Id id;
+    std::string name;
+
+    /// Display color, empty if the bracket has none
+    std::string color;
+};
+
+/**
+ * @brief Metadata of a leaderboard view
+ */
+struct View {
+    std::string slug;
+    std::string name;
+};
+
+/**
+ * @brief One leaderboard row
+ *
+ * Sort keys come first so comparisons read the start of the entry only.
+ */
+struct LeaderboardEntry {
+    int64_t score = 0;
+    int32_t rank = 0;
+
+    /// Index into Leaderboard::brackets, or -1 if the entry has no bracket
+    int32_t bracket = -1;
+
+    Id player_id;
+    std::string submitted_at;
+    std::string metadata;
+};
+
+/**
+ * @brief A page of leaderboard entries (see GetLeaderboardResponse)
+ */
+struct Leaderboard {
+    std::vector<LeaderboardEntry> entries;
+
+    /// Distinct brackets of the page, referenced by LeaderboardEntry::bracket
+    std::vector<Bracket> brackets;
+
+    int32_t total_entries = 0;
+    bool has_more = false;
+    std::string period_start;
+    std::optional<std::string> period_end;
+    std::optional<View> view;
+
+    /// Get an entry's bracket, or nullptr if it has none
+    [[nodiscard]] const Bracket* bracket_of(const LeaderboardEntry& entry) const noexcept {
+        if (entry.bracket < 0 || static_cast<size_t>(entry.bracket) >= brackets.size()) {
+            return nullptr;
+        }
+        return &brackets[static_cast<size_t>(entry.bracket)];
+    }
+};
+
+/**
+ * @brief A player's position (see GetPlayerRankResponse)
+ */
+struct PlayerRank {
+    /// Unset if the player has no score in the period
+    std::optional<int32_t> rank;
+    std::optional<int64_t> score;
+    std::optional<int64_t> best_score;
+    int32_t total_entries = 0;
+    std::optional<std::string> percentile;
+    std::optional<Bracket> bracket;
+    std::optional<View> view;
+
+    /// The player's position on the whole leaderboard (view queries only)
+    std::optional<int32_t> global_rank;
+    std::optional<int32_t> global_total_entries;
+    std::optional<std::string> global_percentile;
+};
+
+/**
+ * @brief One anticheat rule a submission broke
+ */
+struct AnticheatViolation {
+    std::string flag_type;
+    std::string reason;
+};
+
+/**
+ * @brief Outcome of the server's anticheat checks
+ */
+struct Anticheat {
+    bool passed = true;
+    std::string action;
+    std::vector<AnticheatViolation> violations;
+};
+
+/**
+ * @brief Outcome of a score submission (see SubmitScoreResponse)
+ */
+struct SubmitResult {
+    std::string score_id;
+    int32_t rank = 0;
+    bool is_new_best = false;
+    bool was_deduplicated = false;
+    std::optional<Anticheat> anticheat;
+};
+
+} // namespace flat
+} // namespace ascnd
+
+namespace std {
+template<>
+struct hash<ascnd::flat::Id> {
+    size_t operator()(const ascnd::flat::Id& id) const noexcept {
+        return hash<string_view>()(id.view());
+    }
+};
+}  // namespace std
@@ -0,0 +1,119 @@
+#pragma once
+
+/**
+ * @file rank_watcher.hpp
+ * @brief Push notifications of rank changes for tracked players
+ *
+ * A RankWatcher keeps one WatchPlayerRanks RPC open and receives an event
+ * whenever a watched player's rank changes, replacing per-player polling of
+ * get_player_rank().
+ */
+
+#include "export.hpp"
+#include "types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace grpc {
+class Channel;
+class ClientContext;
+}  // namespace grpc
+
+namespace ascnd {
+
+/**
+ * @brief Callback receiving rank change events
+ *
+ * Invoked on a background thread, only for players that are still watched.
+ * Keep it short and non-blocking.
+ */
+using RankChangeCallback = std::function<void(const RankChangeEvent& event)>;
+
+/**
+ * @brief Client side of a WatchPlayerRanks RPC
+ *
+ * Obtained from AscndClient::watch_player_ranks(). All methods are
+ * thread-safe. Each newly watched player receives an event with their
+ * current rank, then one whenever it changes. Destroying a watcher that has
+ * not been closed cancels the stream.
+ *
+ * Example:
+ * @code
+ * auto watcher = client.watch_player_ranks([](const ascnd::RankChangeEvent& event) {
+ *     if (event.has_previous_rank() && event.rank() > event.previous_rank()) {
+ *         notify_overtaken(event.player_id(), event.rank());
+ *     }
+ * });
+ *
+ * watcher->watch("battle-royale", {"player123", "player456"});
+ * // ... when a player goes offline
+ * watcher->unwatch("battle-royale", {"player456"});
+ * @endcode
+ */
+class ASCND_API RankWatcher {
+public:
+    ~RankWatcher();
+
+    RankWatcher(const RankWatcher&) = delete;
+    RankWatcher& operator=(const RankWatcher&) = delete;
+
+    /**
+     * @brief Start watching players on a leaderboard
+     * @param leaderboard_id Leaderboard identifier
+     * @param player_ids Players to watch; already watched players are ignored
+     * @return false if the stream is closed
+     */
+    bool watch(const std::string& leaderboard_id, const std::vector<std::string>& player_ids);
+
+    /**
+     * @brief Stop watching players on a leaderboard
+     *
+     * Waits for a callback already running, so no callback for these
+     * players is running or starts once this returns, even if the server
+     * already sent further events. May be called from the callback.
+     *
+     * @param leaderboard_id Leaderboard identifier
+     * @param player_ids Players to stop watching; unknown players are ignored
+     * @return false if the stream is closed
+     */
+    bool unwatch(const std::string& leaderboard_id, const std::vector<std::string>& player_ids);
+
+    /**
+     * @brief Close the stream and wait for it to end
+     * @return Result containing the number of events delivered, or the
+     *         error that terminated the stream
+     */
+    Result<uint64_t> close();
+
+    /**
+     * @brief Whether the stream is still open
+     */
+    [[nodiscard]] bool is_open() const;
+
+    /**
+     * @brief Number of players currently watched across all leaderboards
+     */
+    [[nodiscard]] size_t watched_count() const;
+
+private:
+    friend class AscndClient;
+
+    class Impl;
+
+    static std::unique_ptr<RankWatcher> open(
+        const std::shared_ptr<grpc::Channel>& channel,
+        std::unique_ptr<grpc::ClientContext> context,
+        RankChangeCallback callback
+    );
+
+    explicit RankWatcher(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace ascnd
@@ -0,0 +1,123 @@
+#pragma once
+
+/**
+ * @file score_stream.hpp
+ * @brief Long-lived score submission stream
+ *
+ * A ScoreStream keeps one SubmitScoreStream RPC open and writes submissions
+ * onto it, avoiding per-call stream setup and header overhead for games
+ * that emit scores continuously.
+ */
+
+#include "export.hpp"
+#include "types.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <memory>
+
+namespace grpc {
+class Channel;
+class ClientContext;
+}  // namespace grpc
+
+namespace ascnd {
+
+/**
+ * @brief Options for AscndClient::open_score_stream()
+ */
+struct ScoreStreamOptions {
+    /// Maximum number of unacknowledged submissions. write() blocks and
+    /// try_write() fails while this many are outstanding (default: 64)
+    int max_in_flight = 64;
+};
+
+/**
+ * @brief Callback receiving the outcome of each streamed submission
+ *
+ * Invoked exactly once per accepted write with the submission's sequence
+ * number, on a background thread. Keep it short and non-blocking.
+ */
+using ScoreAckCallback = std::function<void(uint64_t sequence, Result<SubmitScoreResponse> result)>;
+
+/**
+ * @brief Client side of a SubmitScoreStream RPC
+ *
+ * Obtained from AscndClient::open_score_stream(). All methods are
+ * thread-safe. Destroying a stream that has not been finished cancels it;
+ * outstanding submissions are then reported to the callback as errors.
+ *
+ * Example:
+ * @code
+ * auto stream = client.open_score_stream(
+ *     [](uint64_t seq, ascnd::Result<ascnd::SubmitScoreResponse> result) {
+ *         if (result) std::cout << seq << " -> rank " << result.value().rank() << "\n";
+ *     });
+ *
+ * ascnd::SubmitScoreRequest req;
+ * req.set_leaderboard_id("battle-royale");
+ * req.set_player_id("player123");
+ * req.set_score(250);
+ * stream->write(req);
+ *
+ * stream->finish();  // Waits for outstanding acknowledgements
+ * @endcode
+ */
+class ASCND_API ScoreStream {
+public:
+    ~ScoreStream();
+
+    ScoreStream(const ScoreStream&) = delete;
+    ScoreStream& operator=(const ScoreStream&) = delete;
+
+    /**
+     * @brief Write a submission, blocking while max_in_flight are outstanding
+     * @param request Score submission
+     * @return Result containing the submission's sequence number, or an
+     *         error if the stream is closed
+     */
+    Result<uint64_t> write(const SubmitScoreRequest& request);
+
+    /**
+     * @brief Write a submission without blocking
+     * @param request Score submission
+     * @return Result containing the submission's sequence number, or an
+     *         error if the stream is closed or max_in_flight are outstanding
+     */
+    Result<uint64_t> try_write(const SubmitScoreRequest& request);
+
+    /**
+     * @brief Close the stream and wait for all outstanding acknowledgements
+     * @return Result containing the number of acknowledged submissions, or
+     *         the error that terminated the stream
+     */
+    Result<uint64_t> finish();
+
+    /**
+     * @brief Whether the stream still accepts writes
+     */
+    [[nodiscard]] bool is_open() const;
+
+    /**
+     * @brief Number of written submissions not yet acknowledged
+     */
+    [[nodiscard]] uint64_t in_flight() const;
+
+private:
+    friend class AscndClient;
+
+    class Impl;
+
+    static std::unique_ptr<ScoreStream> open(
+        const std::shared_ptr<grpc::Channel>& channel,
+        std::unique_ptr<grpc::ClientContext> context,
+        ScoreAckCallback callback,
+        ScoreStreamOptions options
+    );
+
+    explicit ScoreStream(std::unique_ptr<Impl> impl);
+
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace ascnd
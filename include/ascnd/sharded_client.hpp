@@ -0,0 +1,89 @@
+#pragma once
+
+/**
+ * @file sharded_client.hpp
+ * @brief Per-thread client shards for heavily multi-threaded servers
+ *
+ * A ShardedClient owns several independent AscndClient shards and hands
+ * each calling thread its own, so threads never contend on a shared
+ * connection, counter or cache. Credentials, the TLS session cache and
+ * gRPC's threads stay shared by all shards.
+ */
+
+#include "client.hpp"
+#include "export.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace ascnd {
+
+/**
+ * @brief A set of AscndClient shards, one per group of worker threads
+ *
+ * Each shard has its own connection (ClientConfig::dedicated_connection is
+ * set on all of them), its own activity counters and its own caches. A
+ * thread is assigned a shard on first use and keeps it; threads are spread
+ * round-robin, so with at least as many shards as threads each thread has
+ * one to itself.
+ *
+ * Per-player state is per shard: submission limits, known best scores and
+ * reused rank responses only see the requests of threads sharing a shard.
+ * Keep a player's traffic on one thread where those features matter.
+ *
+ * Example:
+ * @code
+ * ascnd::ShardedClient clients(config, 64);
+ *
+ * // On any worker thread
+ * auto result = clients.local().submit_score("high-scores", player_id, score);
+ *
+ * // Totals across all shards
+ * uint64_t hits = clients.stats().player_rank_cache_hits;
+ * @endcode
+ */
+class ASCND_API ShardedClient {
+public:
+    /**
+     * @brief Create the shards
+     * @param config Configuration shared by every shard
+     * @param shards Number of shards; 0 uses the number of hardware threads
+     * @throws std::invalid_argument if the configuration is invalid
+     */
+    explicit ShardedClient(ClientConfig config, size_t shards = 0);
+    ~ShardedClient();
+
+    ShardedClient(const ShardedClient&) = delete;
+    ShardedClient& operator=(const ShardedClient&) = delete;
+
+    /**
+     * @brief The calling thread's shard
+     */
+    [[nodiscard]] AscndClient& local();
+
+    /**
+     * @brief A shard by index, for callers that route requests themselves
+     * @param index Shard index, less than shard_count()
+     * @throws std::out_of_range if index is not a shard
+     */
+    [[nodiscard]] AscndClient& shard(size_t index);
+
+    [[nodiscard]] size_t shard_count() const { return shards_.size(); }
+
+    /**
+     * @brief Update the API key on every shard
+     */
+    void set_api_key(const std::string& api_key);
+
+    /**
+     * @brief Activity counters summed over all shards
+     */
+    [[nodiscard]] ClientStats stats() const;
+
+private:
+    std::vector<std::unique_ptr<AscndClient>> shards_;
+};
+
+} // namespace ascnd
@@ -6,13 +6,19 @@
  *
  * This header provides type aliases for the generated protobuf types
  * and utility types for error handling.
+ *
+ * The public API takes and returns these messages by value, so the
+ * generated ascnd.pb.h and the protobuf runtime headers are part of the
+ * SDK's interface: consumers compile them, and must build against the same
+ * generated code and protobuf version as the library. Only the gRPC headers
+ * are kept behind the client's implementation.
  */
 
 #include <string>
 #include <optional>
 #include <cstdint>
 
-// Include generated protobuf types
+// Include generated protobuf types (part of the public interface, see above)
 #include "ascnd.pb.h"
 
 namespace ascnd {
@@ -25,19 +31,58 @@ namespace ascnd {
 using SubmitScoreRequest = ::ascnd::v1::SubmitScoreRequest;
 using GetLeaderboardRequest = ::ascnd::v1::GetLeaderboardRequest;
 using GetPlayerRankRequest = ::ascnd::v1::GetPlayerRankRequest;
+using GetPlayerRanksRequest = ::ascnd::v1::GetPlayerRanksRequest;
+using SubmitScoreBatchRequest = ::ascnd::v1::SubmitScoreBatchRequest;
+using GetLeaderboardRulesRequest = ::ascnd::v1::GetLeaderboardRulesRequest;
 
 // Response types
 using SubmitScoreResponse = ::ascnd::v1::SubmitScoreResponse;
 using GetLeaderboardResponse = ::ascnd::v1::GetLeaderboardResponse;
 using GetPlayerRankResponse = ::ascnd::v1::GetPlayerRankResponse;
+using GetPlayerRanksResponse = ::ascnd::v1::GetPlayerRanksResponse;
+using SubmitScoreBatchResponse = ::ascnd::v1::SubmitScoreBatchResponse;
+using GetLeaderboardRulesResponse = ::ascnd::v1::GetLeaderboardRulesResponse;
 
 // Supporting types
 using LeaderboardEntry = ::ascnd::v1::LeaderboardEntry;
+using SubmitScoreResult = ::ascnd::v1::SubmitScoreResult;
+using PlayerRankResult = ::ascnd::v1::PlayerRankResult;
+using ScoreStreamRequest = ::ascnd::v1::ScoreStreamRequest;
+using ScoreStreamAck = ::ascnd::v1::ScoreStreamAck;
+using WatchPlayerRanksRequest = ::ascnd::v1::WatchPlayerRanksRequest;
+using RankChangeEvent = ::ascnd::v1::RankChangeEvent;
 using AnticheatResult = ::ascnd::v1::AnticheatResult;
 using AnticheatViolation = ::ascnd::v1::AnticheatViolation;
 using BracketInfo = ::ascnd::v1::BracketInfo;
 using ViewInfo = ::ascnd::v1::ViewInfo;
 
+// ============================================================================
+// Response Helpers
+// ============================================================================
+
+/**
+ * @brief Get a leaderboard entry's bracket
+ *
+ * Resolves both brackets sent inline and references into the response's
+ * bracket dictionary (see GetLeaderboardRequest::bracket_dictionary), so
+ * callers work the same either way.
+ *
+ * @param response Response the entry belongs to
+ * @param entry Leaderboard entry
+ * @return The entry's bracket, or nullptr if it has none
+ */
+inline const BracketInfo* entry_bracket(const GetLeaderboardResponse& response,
+                                        const LeaderboardEntry& entry) {
+    if (entry.has_bracket()) {
+        return &entry.bracket();
+    }
+    if (entry.has_bracket_index() && entry.bracket_index() >= 0 &&
+        entry.bracket_index() < response.brackets_size()) {
+        return &response.brackets(entry.bracket_index());
+    }
+    return nullptr;
+}
+
 // ============================================================================
 // Result Type
 // ============================================================================
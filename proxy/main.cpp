@@ -0,0 +1,152 @@
+/**
+ * @file main.cpp
+ * @brief ascnd-proxy: local aggregation proxy for the Ascnd API
+ *
+ * Usage:
+ *   ascnd-proxy --upstream=api.ascnd.gg:443 [--listen=unix:/run/ascnd-proxy.sock]
+ *               [--channels=2] [--batch-window-ms=5] [--max-batch=100]
+ *               [--timeout-ms=10000] [--insecure] [--no-coalesce]
+ *               [--tls-roots=FILE] [--tls-cert=FILE --tls-key=FILE] [--tls-pin=FILE]
+ *
+ * The API key for requests without authorization metadata is read from the
+ * ASCND_API_KEY environment variable.
+ */
+
+#include "proxy_server.hpp"
+#include "ascnd/client.hpp"
+
+#include <glog/logging.h>
+
+#include <atomic>
+#include <chrono>
+#include <csignal>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+
+namespace {
+
+std::atomic<bool> g_shutdown_requested{false};
+
+void HandleSignal(int /*signal*/) {
+    g_shutdown_requested = true;
+}
+
+bool ParseFlag(const std::string& arg, const std::string& name, std::string* value) {
+    std::string prefix = "--" + name + "=";
+    if (arg.compare(0, prefix.size(), prefix) != 0) {
+        return false;
+    }
+    *value = arg.substr(prefix.size());
+    return true;
+}
+
+// Reads a PEM file named by a flag; throws if it cannot be read
+std::string ReadPemFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("cannot read " + path);
+    }
+    std::ostringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+
+void PrintUsage() {
+    std::cerr << "Usage: ascnd-proxy --upstream=HOST:PORT [--listen=ADDRESS]\n"
+              << "                   [--channels=N] [--batch-window-ms=N] [--max-batch=N]\n"
+              << "                   [--timeout-ms=N] [--insecure] [--no-coalesce]\n"
+              << "                   [--tls-roots=FILE] [--tls-cert=FILE --tls-key=FILE]\n"
+              << "                   [--tls-pin=FILE]\n";
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+    ascnd::InitLogging();
+
+    std::string listen_address = "127.0.0.1:50051";
+    ascnd::proxy::ProxyOptions options;
+    if (const char* api_key = std::getenv("ASCND_API_KEY")) {
+        options.api_key = api_key;
+    }
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        std::string value;
+        try {
+            if (ParseFlag(arg, "upstream", &value)) {
+                options.upstream_address = value;
+            } else if (ParseFlag(arg, "listen", &value)) {
+                listen_address = value;
+            } else if (ParseFlag(arg, "channels", &value)) {
+                options.upstream_channels = std::stoi(value);
+            } else if (ParseFlag(arg, "batch-window-ms", &value)) {
+                options.batch_window_ms = std::stoi(value);
+            } else if (ParseFlag(arg, "max-batch", &value)) {
+                options.max_batch_size = std::stoi(value);
+            } else if (ParseFlag(arg, "timeout-ms", &value)) {
+                options.request_timeout_ms = std::stoi(value);
+            } else if (ParseFlag(arg, "tls-roots", &value)) {
+                options.tls_root_certs_pem = ReadPemFile(value);
+            } else if (ParseFlag(arg, "tls-cert", &value)) {
+                options.tls_client_cert_pem = ReadPemFile(value);
+            } else if (ParseFlag(arg, "tls-key", &value)) {
+                options.tls_client_key_pem = ReadPemFile(value);
+            } else if (ParseFlag(arg, "tls-pin", &value)) {
+                options.tls_pinned_server_cert_pem = ReadPemFile(value);
+            } else if (arg == "--insecure") {
+                options.upstream_use_ssl = false;
+            } else if (arg == "--no-coalesce") {
+                options.coalesce_reads = false;
+            } else {
+                std::cerr << "Unknown argument: " << arg << std::endl;
+                PrintUsage();
+                return 2;
+            }
+        } catch (const std::runtime_error& e) {
+            std::cerr << "Invalid value for " << arg << ": " << e.what() << std::endl;
+            return 2;
+        } catch (const std::exception&) {
+            std::cerr << "Invalid value for " << arg << std::endl;
+            return 2;
+        }
+    }
+
+    std::unique_ptr<ascnd::proxy::ProxyService> service;
+    try {
+        service = std::make_unique<ascnd::proxy::ProxyService>(options);
+    } catch (const std::invalid_argument& e) {
+        std::cerr << "Invalid configuration: " << e.what() << std::endl;
+        PrintUsage();
+        return 2;
+    }
+
+    // Downstream traffic stays on this host, so it is served without TLS
+    grpc::ServerBuilder builder;
+    builder.AddListeningPort(listen_address, grpc::InsecureServerCredentials());
+    builder.RegisterService(service.get());
+    std::unique_ptr<grpc::Server> server = builder.BuildAndStart();
+    if (!server) {
+        LOG(ERROR) << "Failed to listen on " << listen_address;
+        return 1;
+    }
+    LOG(INFO) << "ascnd-proxy listening on " << listen_address;
+
+    std::signal(SIGINT, HandleSignal);
+    std::signal(SIGTERM, HandleSignal);
+    while (!g_shutdown_requested) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(200));
+    }
+
+    LOG(INFO) << "Shutting down ascnd-proxy";
+    server->Shutdown(std::chrono::system_clock::now() + std::chrono::seconds(5));
+    server.reset();
+    service.reset();
+    ascnd::ShutdownLogging();
+    return 0;
+}
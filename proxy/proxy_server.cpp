@@ -0,0 +1,510 @@
+/**
+ * @file proxy_server.cpp
+ * @brief Implementation of the local aggregation proxy
+ */
+
+#include "proxy_server.hpp"
+#include "ascnd/client.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ascnd {
+namespace proxy {
+
+namespace {
+
+using Clock = std::chrono::steady_clock;
+
+// An upstream call and the state that must outlive it
+template<typename RequestT, typename ResponseT>
+struct UpstreamCall {
+    grpc::ClientContext context;
+    RequestT request;
+    ResponseT response;
+};
+
+// A downstream read waiting for a (possibly shared) upstream call
+template<typename ResponseT>
+struct ReadWaiter {
+    ResponseT* response;
+    grpc::ServerUnaryReactor* reactor;
+};
+
+// Downstream reads keyed by request; all waiters of a key share one upstream call
+template<typename ResponseT>
+using InflightReads = std::unordered_map<std::string, std::vector<ReadWaiter<ResponseT>>>;
+
+// A downstream submission waiting to be forwarded in a batch
+struct PendingSubmission {
+    ::ascnd::v1::SubmitScoreRequest request;
+    ::ascnd::v1::SubmitScoreResponse* response;
+    grpc::ServerUnaryReactor* reactor;
+    std::chrono::system_clock::time_point deadline;  // Of the downstream call
+};
+
+struct PendingBatch {
+    std::vector<PendingSubmission> items;
+    Clock::time_point flush_at;
+};
+
+}  // anonymous namespace
+
+class ProxyService::Impl {
+public:
+    ProxyOptions options;
+
+    std::vector<std::unique_ptr<::ascnd::v1::AscndService::Stub>> stubs;
+    std::atomic<size_t> next_stub{0};
+
+    // Counters
+    std::atomic<uint64_t> downstream_requests{0};
+    std::atomic<uint64_t> upstream_requests{0};
+    std::atomic<uint64_t> coalesced_reads{0};
+    std::atomic<uint64_t> batched_submissions{0};
+    std::atomic<uint64_t> upstream_batches{0};
+
+    // Read coalescing
+    std::mutex reads_mutex;
+    InflightReads<::ascnd::v1::GetLeaderboardResponse> leaderboard_reads;
+    InflightReads<::ascnd::v1::GetPlayerRankResponse> rank_reads;
+    InflightReads<::ascnd::v1::GetPlayerRanksResponse> ranks_reads;
+    InflightReads<::ascnd::v1::GetLeaderboardRulesResponse> rules_reads;
+
+    // Submission batching, keyed by downstream authorization
+    std::mutex batch_mutex;
+    std::condition_variable batch_cv;
+    std::map<std::string, PendingBatch> batches;
+    bool stopping = false;
+    std::thread flusher;
+
+    // Cleared when the upstream does not implement SubmitScoreBatch
+    std::atomic<bool> batch_supported{true};
+
+    // Upstream calls in flight; the destructor waits for these to complete
+    std::mutex inflight_mutex;
+    std::condition_variable inflight_cv;
+    int inflight_calls = 0;
+
+    explicit Impl(ProxyOptions opts) : options(std::move(opts)) {
+        options.validate();  // Throws std::invalid_argument on invalid options
+
+        // Upstream channels are built like the client's, so TLS roots,
+        // mutual TLS, pinning and session resumption behave the same
+        ClientConfig upstream;
+        upstream.server_address = options.upstream_address;
+        upstream.use_ssl = options.upstream_use_ssl;
+        upstream.tls_root_certs_pem = options.tls_root_certs_pem;
+        upstream.tls_client_cert_pem = options.tls_client_cert_pem;
+        upstream.tls_client_key_pem = options.tls_client_key_pem;
+        upstream.tls_pinned_server_cert_pem = options.tls_pinned_server_cert_pem;
+        upstream.user_agent = "ascnd-proxy/1.0.0";
+        // Give every channel its own connection instead of sharing subchannels
+        upstream.dedicated_connection = true;
+
+        for (int i = 0; i < options.upstream_channels; ++i) {
+            stubs.push_back(::ascnd::v1::AscndService::NewStub(CreateChannel(upstream)));
+        }
+
+        LOG(INFO) << "Proxy forwarding to " << options.upstream_address << " over "
+                  << options.upstream_channels << " channel(s)";
+
+        if (options.batch_window_ms > 0) {
+            flusher = std::thread([this]() { run_flusher(); });
+        }
+    }
+
+    ~Impl() {
+        {
+            std::lock_guard<std::mutex> lock(batch_mutex);
+            stopping = true;
+        }
+        batch_cv.notify_all();
+        if (flusher.joinable()) {
+            flusher.join();  // Flushes everything still pending
+        }
+
+        std::unique_lock<std::mutex> lock(inflight_mutex);
+        inflight_cv.wait(lock, [this]() { return inflight_calls == 0; });
+    }
+
+    ::ascnd::v1::AscndService::Stub& pick_stub() {
+        return *stubs[next_stub.fetch_add(1, std::memory_order_relaxed) % stubs.size()];
+    }
+
+    static std::string authorization_of(grpc::CallbackServerContext* context) {
+        const auto& metadata = context->client_metadata();
+        auto it = metadata.find("authorization");
+        if (it == metadata.end()) {
+            return {};
+        }
+        return std::string(it->second.data(), it->second.size());
+    }
+
+    // The upstream call gets the downstream deadline when that is sooner
+    // than the configured timeout
+    void prepare_context(grpc::ClientContext& context, const std::string& authorization,
+                         std::chrono::system_clock::time_point deadline) {
+        context.set_deadline(std::min(deadline, std::chrono::system_clock::now() +
+                                      std::chrono::milliseconds(options.request_timeout_ms)));
+        if (!authorization.empty()) {
+            context.AddMetadata("authorization", authorization);
+        } else if (!options.api_key.empty()) {
+            context.AddMetadata("authorization", "Bearer " + options.api_key);
+        }
+    }
+
+    void begin_upstream() {
+        ++upstream_requests;
+        std::lock_guard<std::mutex> lock(inflight_mutex);
+        ++inflight_calls;
+    }
+
+    void end_upstream() {
+        std::lock_guard<std::mutex> lock(inflight_mutex);
+        if (--inflight_calls == 0) {
+            inflight_cv.notify_all();
+        }
+    }
+
+    // ------------------------------------------------------------------------
+    // Reads
+    // ------------------------------------------------------------------------
+
+    template<typename RequestT, typename ResponseT, typename StartFunc>
+    grpc::ServerUnaryReactor* forward_read(
+        grpc::CallbackServerContext* context,
+        const RequestT* request,
+        ResponseT* response,
+        InflightReads<ResponseT>& inflight,
+        StartFunc start
+    ) {
+        ++downstream_requests;
+        auto* reactor = context->DefaultReactor();
+        std::string authorization = authorization_of(context);
+
+        std::string key;
+        if (options.coalesce_reads) {
+            key = authorization;
+            key.push_back('\0');
+            request->AppendToString(&key);
+
+            std::lock_guard<std::mutex> lock(reads_mutex);
+            auto it = inflight.find(key);
+            if (it != inflight.end()) {
+                it->second.push_back({response, reactor});
+                ++coalesced_reads;
+                return reactor;
+            }
+            inflight[key].push_back({response, reactor});
+        }
+
+        auto call = std::make_shared<UpstreamCall<RequestT, ResponseT>>();
+        call->request = *request;
+        // A shared read must not fail later joiners because the first caller
+        // was impatient, so it gets the proxy's timeout; each downstream
+        // call still ends at its own deadline
+        auto deadline = options.coalesce_reads ? std::chrono::system_clock::time_point::max()
+                                               : context->deadline();
+        prepare_context(call->context, authorization, deadline);
+
+        begin_upstream();
+        start(pick_stub(), call, [this, call, key, response, reactor, &inflight](grpc::Status status) {
+            std::vector<ReadWaiter<ResponseT>> waiters;
+            if (options.coalesce_reads) {
+                std::lock_guard<std::mutex> lock(reads_mutex);
+                auto it = inflight.find(key);
+                waiters = std::move(it->second);
+                inflight.erase(it);
+            } else {
+                waiters.push_back({response, reactor});
+            }
+
+            for (auto& waiter : waiters) {
+                if (status.ok()) {
+                    *waiter.response = call->response;
+                }
+                waiter.reactor->Finish(status);
+            }
+            end_upstream();
+        });
+        return reactor;
+    }
+
+    // ------------------------------------------------------------------------
+    // Submissions
+    // ------------------------------------------------------------------------
+
+    void forward_submission(const std::string& authorization, PendingSubmission item) {
+        auto call = std::make_shared<UpstreamCall<::ascnd::v1::SubmitScoreRequest,
+                                                  ::ascnd::v1::SubmitScoreResponse>>();
+        call->request = std::move(item.request);
+        prepare_context(call->context, authorization, item.deadline);
+
+        begin_upstream();
+        pick_stub().async()->SubmitScore(
+            &call->context, &call->request, &call->response,
+            [this, call, item](grpc::Status status) {
+                if (status.ok()) {
+                    *item.response = std::move(call->response);
+                }
+                item.reactor->Finish(status);
+                end_upstream();
+            });
+    }
+
+    void enqueue_submission(const std::string& authorization, PendingSubmission item) {
+        if (options.batch_window_ms == 0) {
+            forward_submission(authorization, std::move(item));
+            return;
+        }
+
+        std::vector<PendingSubmission> full_batch;
+        {
+            std::lock_guard<std::mutex> lock(batch_mutex);
+            auto& batch = batches[authorization];
+            if (batch.items.empty()) {
+                batch.flush_at = Clock::now() + std::chrono::milliseconds(options.batch_window_ms);
+            }
+            batch.items.push_back(std::move(item));
+            if (static_cast<int>(batch.items.size()) >= options.max_batch_size) {
+                full_batch = std::move(batch.items);
+                batches.erase(authorization);
+            }
+        }
+
+        if (!full_batch.empty()) {
+            dispatch_batch(authorization, std::move(full_batch));
+        } else {
+            batch_cv.notify_one();
+        }
+    }
+
+    void run_flusher() {
+        std::unique_lock<std::mutex> lock(batch_mutex);
+        while (true) {
+            if (batches.empty()) {
+                if (stopping) {
+                    return;
+                }
+                batch_cv.wait(lock, [this]() { return stopping || !batches.empty(); });
+                continue;
+            }
+
+            auto next_flush = Clock::time_point::max();
+            for (const auto& entry : batches) {
+                next_flush = std::min(next_flush, entry.second.flush_at);
+            }
+            if (!stopping && Clock::now() < next_flush) {
+                batch_cv.wait_until(lock, next_flush);
+                continue;
+            }
+
+            std::vector<std::pair<std::string, std::vector<PendingSubmission>>> due;
+            auto now = Clock::now();
+            for (auto it = batches.begin(); it != batches.end();) {
+                if (stopping || it->second.flush_at <= now) {
+                    due.emplace_back(it->first, std::move(it->second.items));
+                    it = batches.erase(it);
+                } else {
+                    ++it;
+                }
+            }
+
+            lock.unlock();
+            for (auto& batch : due) {
+                dispatch_batch(batch.first, std::move(batch.second));
+            }
+            lock.lock();
+        }
+    }
+
+    void dispatch_batch(const std::string& authorization, std::vector<PendingSubmission> items) {
+        if (items.size() == 1 || !batch_supported.load()) {
+            for (auto& item : items) {
+                forward_submission(authorization, std::move(item));
+            }
+            return;
+        }
+
+        batched_submissions += items.size();
+        ++upstream_batches;
+
+        // The batch lives as long as its most patient caller
+        auto call = std::make_shared<UpstreamCall<::ascnd::v1::SubmitScoreBatchRequest,
+                                                  ::ascnd::v1::SubmitScoreBatchResponse>>();
+        auto deadline = std::chrono::system_clock::time_point::min();
+        for (auto& item : items) {
+            *call->request.add_submissions() = std::move(item.request);
+            deadline = std::max(deadline, item.deadline);
+        }
+        prepare_context(call->context, authorization, deadline);
+
+        auto waiters = std::make_shared<std::vector<PendingSubmission>>(std::move(items));
+        begin_upstream();
+        pick_stub().async()->SubmitScoreBatch(
+            &call->context, &call->request, &call->response,
+            [this, call, waiters, authorization](grpc::Status status) {
+                if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED) {
+                    LOG(WARNING) << "Upstream does not support SubmitScoreBatch; "
+                                 << "forwarding submissions individually";
+                    batch_supported = false;
+                    for (int i = 0; i < call->request.submissions_size(); ++i) {
+                        auto& waiter = (*waiters)[i];
+                        waiter.request = std::move(*call->request.mutable_submissions(i));
+                        forward_submission(authorization, std::move(waiter));
+                    }
+                } else {
+                    finish_batch(status, call->response, *waiters);
+                }
+                end_upstream();
+            });
+    }
+
+    static void finish_batch(const grpc::Status& status,
+                             ::ascnd::v1::SubmitScoreBatchResponse& response,
+                             std::vector<PendingSubmission>& waiters) {
+        for (size_t i = 0; i < waiters.size(); ++i) {
+            auto& waiter = waiters[i];
+            if (!status.ok()) {
+                waiter.reactor->Finish(status);
+                continue;
+            }
+            if (static_cast<int>(i) >= response.results_size()) {
+                waiter.reactor->Finish(grpc::Status(grpc::StatusCode::INTERNAL,
+                                                    "Upstream batch response is missing results"));
+                continue;
+            }
+            auto& result = *response.mutable_results(static_cast<int>(i));
+            if (result.error_code() != 0) {
+                waiter.reactor->Finish(grpc::Status(
+                    static_cast<grpc::StatusCode>(result.error_code()), result.error_message()));
+            } else {
+                *waiter.response = std::move(*result.mutable_response());
+                waiter.reactor->Finish(grpc::Status::OK);
+            }
+        }
+    }
+};
+
+ProxyService::ProxyService(ProxyOptions options)
+    : impl_(std::make_unique<Impl>(std::move(options))) {}
+
+ProxyService::~ProxyService() = default;
+
+ProxyStats ProxyService::stats() const {
+    ProxyStats stats;
+    stats.downstream_requests = impl_->downstream_requests.load();
+    stats.upstream_requests = impl_->upstream_requests.load();
+    stats.coalesced_reads = impl_->coalesced_reads.load();
+    stats.batched_submissions = impl_->batched_submissions.load();
+    stats.upstream_batches = impl_->upstream_batches.load();
+    return stats;
+}
+
+grpc::ServerUnaryReactor* ProxyService::SubmitScore(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::SubmitScoreRequest* request,
+    ::ascnd::v1::SubmitScoreResponse* response
+) {
+    ++impl_->downstream_requests;
+    auto* reactor = context->DefaultReactor();
+    impl_->enqueue_submission(Impl::authorization_of(context),
+                              {*request, response, reactor, context->deadline()});
+    return reactor;
+}
+
+grpc::ServerUnaryReactor* ProxyService::GetLeaderboard(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::GetLeaderboardRequest* request,
+    ::ascnd::v1::GetLeaderboardResponse* response
+) {
+    using Call = UpstreamCall<::ascnd::v1::GetLeaderboardRequest, ::ascnd::v1::GetLeaderboardResponse>;
+    return impl_->forward_read(context, request, response, impl_->leaderboard_reads,
+        [](::ascnd::v1::AscndService::Stub& stub, const std::shared_ptr<Call>& call,
+           std::function<void(grpc::Status)> done) {
+            stub.async()->GetLeaderboard(&call->context, &call->request, &call->response, std::move(done));
+        });
+}
+
+grpc::ServerUnaryReactor* ProxyService::GetPlayerRank(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::GetPlayerRankRequest* request,
+    ::ascnd::v1::GetPlayerRankResponse* response
+) {
+    using Call = UpstreamCall<::ascnd::v1::GetPlayerRankRequest, ::ascnd::v1::GetPlayerRankResponse>;
+    return impl_->forward_read(context, request, response, impl_->rank_reads,
+        [](::ascnd::v1::AscndService::Stub& stub, const std::shared_ptr<Call>& call,
+           std::function<void(grpc::Status)> done) {
+            stub.async()->GetPlayerRank(&call->context, &call->request, &call->response, std::move(done));
+        });
+}
+
+grpc::ServerUnaryReactor* ProxyService::SubmitScoreBatch(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::SubmitScoreBatchRequest* request,
+    ::ascnd::v1::SubmitScoreBatchResponse* response
+) {
+    ++impl_->downstream_requests;
+    auto* reactor = context->DefaultReactor();
+
+    // Already batched by the caller; forward as is
+    auto call = std::make_shared<UpstreamCall<::ascnd::v1::SubmitScoreBatchRequest,
+                                              ::ascnd::v1::SubmitScoreBatchResponse>>();
+    call->request = *request;
+    impl_->prepare_context(call->context, Impl::authorization_of(context), context->deadline());
+
+    impl_->begin_upstream();
+    ++impl_->upstream_batches;
+    impl_->pick_stub().async()->SubmitScoreBatch(
+        &call->context, &call->request, &call->response,
+        [impl = impl_.get(), call, response, reactor](grpc::Status status) {
+            if (status.ok()) {
+                *response = std::move(call->response);
+            }
+            reactor->Finish(status);
+            impl->end_upstream();
+        });
+    return reactor;
+}
+
+grpc::ServerUnaryReactor* ProxyService::GetPlayerRanks(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::GetPlayerRanksRequest* request,
+    ::ascnd::v1::GetPlayerRanksResponse* response
+) {
+    using Call = UpstreamCall<::ascnd::v1::GetPlayerRanksRequest, ::ascnd::v1::GetPlayerRanksResponse>;
+    return impl_->forward_read(context, request, response, impl_->ranks_reads,
+        [](::ascnd::v1::AscndService::Stub& stub, const std::shared_ptr<Call>& call,
+           std::function<void(grpc::Status)> done) {
+            stub.async()->GetPlayerRanks(&call->context, &call->request, &call->response, std::move(done));
+        });
+}
+
+grpc::ServerUnaryReactor* ProxyService::GetLeaderboardRules(
+    grpc::CallbackServerContext* context,
+    const ::ascnd::v1::GetLeaderboardRulesRequest* request,
+    ::ascnd::v1::GetLeaderboardRulesResponse* response
+) {
+    using Call = UpstreamCall<::ascnd::v1::GetLeaderboardRulesRequest,
+                              ::ascnd::v1::GetLeaderboardRulesResponse>;
+    return impl_->forward_read(context, request, response, impl_->rules_reads,
+        [](::ascnd::v1::AscndService::Stub& stub, const std::shared_ptr<Call>& call,
+           std::function<void(grpc::Status)> done) {
+            stub.async()->GetLeaderboardRules(&call->context, &call->request, &call->response,
+                                              std::move(done));
+        });
+}
+
+} // namespace proxy
+} // namespace ascnd
@@ -0,0 +1,191 @@
+#pragma once
+
+/**
+ * @file proxy_server.hpp
+ * @brief Local aggregation proxy for the Ascnd API
+ *
+ * Runs next to many game server processes on the same host. Downstream
+ * clients connect locally (TCP loopback or a Unix domain socket); the proxy
+ * coalesces identical in-flight reads, batches score submissions and
+ * forwards everything upstream over a small pool of channels.
+ */
+
+#include "ascnd.grpc.pb.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+
+namespace ascnd {
+namespace proxy {
+
+/**
+ * @brief Configuration options for ProxyService
+ */
+struct ProxyOptions {
+    /// Upstream API address (e.g., "api.ascnd.gg:443")
+    std::string upstream_address;
+
+    /// Whether to use SSL/TLS for upstream connections (default: true)
+    bool upstream_use_ssl = true;
+
+    /// PEM-encoded root certificates to trust upstream instead of the
+    /// system roots (optional)
+    std::string tls_root_certs_pem;
+
+    /// PEM-encoded client certificate chain for mutual TLS upstream (optional)
+    std::string tls_client_cert_pem;
+
+    /// PEM-encoded private key matching tls_client_cert_pem (optional)
+    std::string tls_client_key_pem;
+
+    /// PEM-encoded upstream server certificate to pin (optional); see
+    /// ClientConfig::tls_pinned_server_cert_pem
+    std::string tls_pinned_server_cert_pem;
+
+    /// API key sent upstream when a downstream request carries no
+    /// authorization metadata (optional)
+    std::string api_key;
+
+    /// Number of upstream channels (connections) to spread requests over (default: 2)
+    int upstream_channels = 2;
+
+    /// Time to collect submissions before forwarding them as one batch, in
+    /// milliseconds. 0 forwards every submission immediately (default: 5)
+    int batch_window_ms = 5;
+
+    /// Maximum number of submissions per upstream batch (default: 100)
+    int max_batch_size = 100;
+
+    /// Upstream request deadline in milliseconds (default: 10000). A
+    /// downstream deadline that expires sooner takes precedence, except
+    /// for coalesced reads, which are shared by callers with different
+    /// deadlines.
+    int request_timeout_ms = 10000;
+
+    /// Share one upstream call between identical in-flight reads (default: true)
+    bool coalesce_reads = true;
+
+    /**
+     * @brief Validate the options
+     * @throws std::invalid_argument if options are invalid
+     */
+    void validate() const {
+        if (upstream_address.empty()) {
+            throw std::invalid_argument("upstream_address cannot be empty");
+        }
+        if (upstream_channels <= 0) {
+            throw std::invalid_argument("upstream_channels must be positive");
+        }
+        if (batch_window_ms < 0) {
+            throw std::invalid_argument("batch_window_ms cannot be negative");
+        }
+        if (max_batch_size <= 0) {
+            throw std::invalid_argument("max_batch_size must be positive");
+        }
+        if (request_timeout_ms <= 0) {
+            throw std::invalid_argument("request_timeout_ms must be positive");
+        }
+        if (tls_client_cert_pem.empty() != tls_client_key_pem.empty()) {
+            throw std::invalid_argument(
+                "tls_client_cert_pem and tls_client_key_pem must be set together");
+        }
+        bool has_tls_options = !tls_root_certs_pem.empty() || !tls_client_cert_pem.empty() ||
+                               !tls_pinned_server_cert_pem.empty();
+        if (has_tls_options && !upstream_use_ssl) {
+            throw std::invalid_argument("TLS certificate options require upstream_use_ssl");
+        }
+    }
+};
+
+/**
+ * @brief Proxy traffic counters
+ */
+struct ProxyStats {
+    /// Requests received from downstream clients
+    uint64_t downstream_requests = 0;
+
+    /// Calls issued to the upstream API
+    uint64_t upstream_requests = 0;
+
+    /// Downstream reads answered by another request's upstream call
+    uint64_t coalesced_reads = 0;
+
+    /// Downstream submissions forwarded as part of a batch
+    uint64_t batched_submissions = 0;
+
+    /// SubmitScoreBatch calls issued upstream
+    uint64_t upstream_batches = 0;
+};
+
+/**
+ * @brief AscndService implementation that aggregates local traffic
+ *
+ * Register with a grpc::ServerBuilder. The service must outlive the server:
+ * shut the server down before destroying the service.
+ *
+ * All unary RPCs are forwarded. The streaming RPCs (SubmitScoreStream,
+ * Session and WatchPlayerRanks) are not proxied and return UNIMPLEMENTED:
+ * clients in session mode fall back to unary calls, while score streams
+ * and rank watchers must connect to the upstream directly.
+ */
+class ProxyService final : public ::ascnd::v1::AscndService::CallbackService {
+public:
+    /**
+     * @brief Create a proxy forwarding to the configured upstream
+     * @param options Proxy options
+     * @throws std::invalid_argument if options are invalid
+     */
+    explicit ProxyService(ProxyOptions options);
+
+    /// Flushes pending submissions and waits for upstream calls to finish
+    ~ProxyService() override;
+
+    ProxyService(const ProxyService&) = delete;
+    ProxyService& operator=(const ProxyService&) = delete;
+
+    /**
+     * @brief Get a snapshot of the traffic counters
+     */
+    [[nodiscard]] ProxyStats stats() const;
+
+    grpc::ServerUnaryReactor* SubmitScore(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::SubmitScoreRequest* request,
+        ::ascnd::v1::SubmitScoreResponse* response) override;
+
+    grpc::ServerUnaryReactor* GetLeaderboard(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::GetLeaderboardRequest* request,
+        ::ascnd::v1::GetLeaderboardResponse* response) override;
+
+    grpc::ServerUnaryReactor* GetPlayerRank(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::GetPlayerRankRequest* request,
+        ::ascnd::v1::GetPlayerRankResponse* response) override;
+
+    grpc::ServerUnaryReactor* SubmitScoreBatch(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::SubmitScoreBatchRequest* request,
+        ::ascnd::v1::SubmitScoreBatchResponse* response) override;
+
+    grpc::ServerUnaryReactor* GetPlayerRanks(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::GetPlayerRanksRequest* request,
+        ::ascnd::v1::GetPlayerRanksResponse* response) override;
+
+    grpc::ServerUnaryReactor* GetLeaderboardRules(
+        grpc::CallbackServerContext* context,
+        const ::ascnd::v1::GetLeaderboardRulesRequest* request,
+        ::ascnd::v1::GetLeaderboardRulesResponse* response) override;
+
+private:
+    class Impl;
+    std::unique_ptr<Impl> impl_;
+};
+
+} // namespace proxy
+} // namespace ascnd
@@ -0,0 +1,89 @@
+/**
+ * @file batch_window.cpp
+ * @brief Implementation of fixed and adaptive batching windows
+ */
+
+#include "batch_window.hpp"
+
+#include <algorithm>
+
+namespace ascnd {
+
+namespace {
+
+double update_average(double average, double sample, double weight) {
+    return average < 0 ? sample : average + weight * (sample - average);
+}
+
+}  // anonymous namespace
+
+BatchWindow::BatchWindow(Clock::duration max_window, bool adaptive)
+    : max_window_(max_window), adaptive_(adaptive) {}
+
+void BatchWindow::arrived(Clock::time_point now) {
+    if (!adaptive_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (arrived_) {
+        double gap = std::chrono::duration<double, std::nano>(now - last_arrival_).count();
+        last_gap_ns_ = std::max(gap, 0.0);
+        gap_ns_ = update_average(gap_ns_, last_gap_ns_, kSampleWeight);
+    }
+    last_arrival_ = now;
+    arrived_ = true;
+}
+
+void BatchWindow::completed(Clock::duration latency) {
+    if (!adaptive_) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    double sample = std::chrono::duration<double, std::nano>(latency).count();
+    latency_ns_ = update_average(latency_ns_, std::max(sample, 0.0), kSampleWeight);
+}
+
+BatchWindow::Clock::duration BatchWindow::next() const {
+    if (!adaptive_) {
+        return max_window_;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (gap_ns_ < 0) {
+        return Clock::duration::zero();  // Nothing to go on yet: treat as idle
+    }
+
+    double target = std::chrono::duration<double, std::nano>(max_window_).count();
+    if (latency_ns_ >= 0) {
+        target = std::min(target, latency_ns_);
+    }
+    // A request after a quiet spell goes at once even if the average has
+    // not caught up yet
+    if (std::max(gap_ns_, last_gap_ns_) >= target) {
+        return Clock::duration::zero();  // No company expected in time
+    }
+    return std::chrono::duration_cast<Clock::duration>(std::chrono::duration<double, std::nano>(target));
+}
+
+size_t BatchWindow::window_bucket(Clock::duration window) {
+    if (window <= Clock::duration::zero()) {
+        return 0;
+    }
+    // Bucket 1 holds windows under 1 ms, bucket 2 under 2 ms, and so on
+    size_t bucket = 1;
+    auto limit = std::chrono::milliseconds(1);
+    while (bucket + 1 < kBuckets && window >= limit) {
+        ++bucket;
+        limit *= 2;
+    }
+    return bucket;
+}
+
+size_t BatchWindow::size_bucket(size_t size) {
+    size_t bucket = 0;
+    while (bucket + 1 < kBuckets && size >= (size_t{2} << bucket)) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+} // namespace ascnd
@@ -0,0 +1,74 @@
+#pragma once
+
+/**
+ * @file batch_window.hpp
+ * @brief How long the first request of a batch waits for others
+ *
+ * Internal to the library; not installed.
+ */
+
+#include <chrono>
+#include <cstddef>
+#include <mutex>
+
+namespace ascnd {
+
+/**
+ * @brief Batching window, fixed or sized from recent traffic
+ *
+ * A fixed window always waits the configured time. An adaptive one keeps
+ * moving averages of the gap between arrivals and of the batch call's
+ * latency, and treats the configured time as an upper bound: much like
+ * Nagle's algorithm, a request is sent at once when the next one is not
+ * expected before the window would close, and otherwise waits up to one
+ * call latency so that a busy client fills its batches. Waiting longer
+ * than a round trip would cost callers more than a second call.
+ * Thread-safe.
+ */
+class BatchWindow {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Buckets in the histograms filled from window_bucket and size_bucket
+    static constexpr size_t kBuckets = 12;
+
+    /**
+     * @param max_window Configured window, the upper bound when adaptive
+     * @param adaptive Size the window from arrivals and latency
+     */
+    BatchWindow(Clock::duration max_window, bool adaptive);
+
+    BatchWindow(const BatchWindow&) = delete;
+    BatchWindow& operator=(const BatchWindow&) = delete;
+
+    /// Record that a request joined or opened a batch
+    void arrived(Clock::time_point now);
+
+    /// Record how long a batch call took
+    void completed(Clock::duration latency);
+
+    /// Window for a batch opened now; zero sends the first request at once
+    [[nodiscard]] Clock::duration next() const;
+
+    /// Histogram bucket of a window: 0 for none, then by power-of-two ms
+    static size_t window_bucket(Clock::duration window);
+
+    /// Histogram bucket of a batch size: sizes 2^i to 2^(i+1) - 1 go in i
+    static size_t size_bucket(size_t size);
+
+private:
+    // Weight of the newest sample in the moving averages
+    static constexpr double kSampleWeight = 0.2;
+
+    const Clock::duration max_window_;
+    const bool adaptive_;
+
+    mutable std::mutex mutex_;
+    Clock::time_point last_arrival_;
+    bool arrived_ = false;
+    double gap_ns_ = -1;      // Negative until two requests have arrived
+    double last_gap_ns_ = -1;
+    double latency_ns_ = -1;  // Negative until a call has completed
+};
+
+} // namespace ascnd
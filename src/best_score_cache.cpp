@@ -0,0 +1,126 @@
+/**
+ * @file best_score_cache.cpp
+ * @brief Implementation of the best score cache
+ */
+
+#include "best_score_cache.hpp"
+
+#include <cstdio>
+
+namespace ascnd {
+
+namespace {
+
+// Days since 1970-01-01 of a proleptic Gregorian date
+int64_t DaysFromCivil(int64_t year, unsigned month, unsigned day) {
+    year -= month <= 2;
+    const int64_t era = (year >= 0 ? year : year - 399) / 400;
+    const unsigned year_of_era = static_cast<unsigned>(year - era * 400);
+    const unsigned day_of_year = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;
+    const unsigned day_of_era = year_of_era * 365 + year_of_era / 4 - year_of_era / 100 + day_of_year;
+    return era * 146097 + static_cast<int64_t>(day_of_era) - 719468;
+}
+
+// Parses "YYYY-MM-DDTHH:MM:SS[.fraction](Z|+HH:MM|-HH:MM)"
+bool ParseTimestamp(const std::string& text, std::chrono::system_clock::time_point* time) {
+    int year = 0, month = 0, day = 0, hour = 0, minute = 0, second = 0;
+    int consumed = 0;
+    if (std::sscanf(text.c_str(), "%4d-%2d-%2dT%2d:%2d:%2d%n",
+                    &year, &month, &day, &hour, &minute, &second, &consumed) != 6) {
+        return false;
+    }
+    if (month < 1 || month > 12 || day < 1 || day > 31 || hour > 23 || minute > 59 || second > 60) {
+        return false;
+    }
+
+    size_t pos = static_cast<size_t>(consumed);
+    if (pos < text.size() && text[pos] == '.') {
+        do {
+            ++pos;
+        } while (pos < text.size() && text[pos] >= '0' && text[pos] <= '9');
+    }
+
+    int64_t offset_seconds = 0;
+    if (pos < text.size() && (text[pos] == '+' || text[pos] == '-')) {
+        int offset_hours = 0, offset_minutes = 0;
+        if (std::sscanf(text.c_str() + pos + 1, "%2d:%2d", &offset_hours, &offset_minutes) != 2) {
+            return false;
+        }
+        offset_seconds = (offset_hours * 60 + offset_minutes) * 60;
+        if (text[pos] == '-') {
+            offset_seconds = -offset_seconds;
+        }
+    } else if (pos >= text.size() || text[pos] != 'Z') {
+        return false;
+    }
+
+    int64_t seconds = DaysFromCivil(year, static_cast<unsigned>(month), static_cast<unsigned>(day)) * 86400 +
+                      hour * 3600 + minute * 60 + second - offset_seconds;
+    // Clamp dates beyond the clock's range (about 292 years from 1970)
+    const auto max_seconds = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::time_point::max().time_since_epoch()).count();
+    if (seconds >= max_seconds) {
+        *time = std::chrono::system_clock::time_point::max();
+    } else if (seconds <= -max_seconds) {
+        *time = std::chrono::system_clock::time_point::min();
+    } else {
+        *time = std::chrono::system_clock::time_point(std::chrono::seconds(seconds));
+    }
+    return true;
+}
+
+}  // anonymous namespace
+
+BestScoreCache::BestScoreCache() : bests_(kMaxTrackedPlayers) {}
+
+bool BestScoreCache::may_improve(const std::string& leaderboard_id,
+                                 const std::string& player_id,
+                                 int64_t score,
+                                 const GetLeaderboardRulesResponse& rules,
+                                 Clock::time_point now) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const Entry* entry = bests_.find(player_key(leaderboard_id, player_id));
+    if (!entry || entry->period_end <= now) {
+        return true;
+    }
+    return ascending(rules) ? score < entry->best : score > entry->best;
+}
+
+void BestScoreCache::record(const std::string& leaderboard_id,
+                            const std::string& player_id,
+                            int64_t score,
+                            const GetLeaderboardRulesResponse& rules,
+                            Clock::time_point now) {
+    Clock::time_point end;
+    if (!period_end(rules, &end) || end <= now) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    const std::string key = player_key(leaderboard_id, player_id);
+    Entry* entry = bests_.find(key);
+    if (!entry || entry->period_end != end) {
+        bests_.put(key, Entry{score, end});
+    } else if (ascending(rules) ? score < entry->best : score > entry->best) {
+        entry->best = score;
+    }
+}
+
+bool BestScoreCache::period_end(const GetLeaderboardRulesResponse& rules,
+                                Clock::time_point* period_end) {
+    if (!rules.has_period_end()) {
+        *period_end = Clock::time_point::max();
+        return true;
+    }
+    return ParseTimestamp(rules.period_end(), period_end);
+}
+
+std::string BestScoreCache::player_key(const std::string& leaderboard_id,
+                                       const std::string& player_id) {
+    std::string key = leaderboard_id;
+    key.push_back('\0');
+    key += player_id;
+    return key;
+}
+
+} // namespace ascnd
@@ -0,0 +1,84 @@
+#pragma once
+
+/**
+ * @file best_score_cache.hpp
+ * @brief Players' best scores in the current period, for skipping
+ *        submissions that cannot beat them
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/types.hpp"
+#include "lru_map.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+
+namespace ascnd {
+
+/**
+ * @brief Remembers the best score each player is known to have reached
+ *
+ * Any score a player successfully submitted is a lower bound on their best
+ * (an upper bound on ascending leaderboards), so a new score that does not
+ * beat it cannot be a new best. Entries are tied to the period they were
+ * recorded in and ignored once the leaderboard's period_end passes. Bounded
+ * to the most recently active players. Thread-safe.
+ */
+class BestScoreCache {
+public:
+    using Clock = std::chrono::system_clock;
+
+    /// Players whose best score is remembered
+    static constexpr size_t kMaxTrackedPlayers = 10000;
+
+    BestScoreCache();
+
+    /**
+     * @brief Whether a score might beat the player's best in the current period
+     * @return false only if a known score in the period is at least as good
+     */
+    bool may_improve(const std::string& leaderboard_id,
+                     const std::string& player_id,
+                     int64_t score,
+                     const GetLeaderboardRulesResponse& rules,
+                     Clock::time_point now);
+
+    /**
+     * @brief Remember a score the player reached in the current period
+     */
+    void record(const std::string& leaderboard_id,
+                const std::string& player_id,
+                int64_t score,
+                const GetLeaderboardRulesResponse& rules,
+                Clock::time_point now);
+
+    /**
+     * @brief Parse the end of the current period from a leaderboard's rules
+     * @param rules Leaderboard rules
+     * @param period_end Receives the period end; Clock::time_point::max()
+     *        if the leaderboard never resets
+     * @return false if period_end is set but not a valid ISO 8601 timestamp
+     */
+    static bool period_end(const GetLeaderboardRulesResponse& rules, Clock::time_point* period_end);
+
+private:
+    struct Entry {
+        int64_t best;
+        Clock::time_point period_end;
+    };
+
+    static bool ascending(const GetLeaderboardRulesResponse& rules) {
+        return rules.sort_order() == "asc";
+    }
+
+    static std::string player_key(const std::string& leaderboard_id, const std::string& player_id);
+
+    std::mutex mutex_;
+    LruMap<std::string, Entry> bests_;
+};
+
+} // namespace ascnd
@@ -0,0 +1,215 @@
+#pragma once
+
+/**
+ * @file bidi_stream.hpp
+ * @brief Shared plumbing for the client's long-lived bidirectional streams
+ *
+ * Internal to the library; not installed.
+ */
+
+#include <grpcpp/grpcpp.h>
+
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+namespace ascnd {
+
+/**
+ * @brief Callback reactor with a thread-safe write queue
+ *
+ * Writes may be issued from any thread; they are sent one at a time, each
+ * started from the previous write's completion. A single hold keeps the call
+ * alive while user threads may still start writes, and is released once the
+ * stream is closed for writing and no write is pending. gRPC then delivers
+ * OnDone, after which the reactor may be destroyed.
+ *
+ * Subclasses receive messages through on_read() and the final status
+ * through on_done(), and may guard their own state with mutex_. cv_ is
+ * notified whenever the stream stops accepting writes.
+ */
+template<typename RequestT, typename ResponseT>
+class BidiStream : public grpc::ClientBidiReactor<RequestT, ResponseT> {
+public:
+    explicit BidiStream(std::unique_ptr<grpc::ClientContext> context)
+        : context_(std::move(context)) {}
+
+    /**
+     * @brief Start the call
+     * @param bind Binds the reactor to its RPC, e.g.
+     *        stub->async()->Method(context, reactor)
+     */
+    template<typename BindFn>
+    void start(BindFn&& bind) {
+        bind(context_.get(), this);
+        this->StartRead(&incoming_);
+        this->AddHold();
+        this->StartCall();
+    }
+
+    /// Half-close the stream once queued writes are flushed
+    void close_writes() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (done_ || writes_done_requested_) {
+            return;
+        }
+        writes_done_requested_ = true;
+        cv_.notify_all();
+        if (write_pending_ || closed_) {
+            return;
+        }
+        write_pending_ = true;
+        lock.unlock();
+        this->StartWritesDone();
+    }
+
+    void cancel() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (done_) {
+                return;
+            }
+        }
+        context_->TryCancel();
+    }
+
+    /// Block until OnDone has run and return the call's status
+    grpc::Status wait_done() {
+        std::unique_lock<std::mutex> lock(mutex_);
+        cv_.wait(lock, [this]() { return done_; });
+        return status_;
+    }
+
+    bool accepts_writes() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return accepts_writes_locked();
+    }
+
+    bool is_done() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return done_;
+    }
+
+    // ------------------------------------------------------------------------
+    // Reactions
+    // ------------------------------------------------------------------------
+
+    void OnWriteDone(bool ok) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!ok) {
+            closed_ = true;
+            cv_.notify_all();
+        }
+
+        if (!closed_ && !queue_.empty()) {
+            current_write_ = std::move(queue_.front());
+            queue_.pop_front();
+            lock.unlock();
+            this->StartWrite(&current_write_);
+            return;
+        }
+        if (!closed_ && writes_done_requested_) {
+            lock.unlock();
+            this->StartWritesDone();
+            return;
+        }
+
+        write_pending_ = false;
+        release_hold(lock);
+    }
+
+    void OnWritesDoneDone(bool /*ok*/) override {
+        std::unique_lock<std::mutex> lock(mutex_);
+        write_pending_ = false;
+        closed_ = true;
+        release_hold(lock);
+    }
+
+    void OnReadDone(bool ok) override {
+        if (!ok) {
+            std::unique_lock<std::mutex> lock(mutex_);
+            closed_ = true;
+            cv_.notify_all();
+            release_hold(lock);
+            return;
+        }
+        on_read(incoming_);
+        incoming_.Clear();
+        this->StartRead(&incoming_);
+    }
+
+    void OnDone(const grpc::Status& status) override {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            queue_.clear();
+        }
+        on_done(status);
+
+        // Last access to this object; the owner may destroy it once notified
+        std::lock_guard<std::mutex> lock(mutex_);
+        status_ = status;
+        done_ = true;
+        cv_.notify_all();
+    }
+
+protected:
+    /// Called for each message received, without mutex_ held
+    virtual void on_read(ResponseT& message) = 0;
+
+    /// Called once when the call ends, without mutex_ held
+    virtual void on_done(const grpc::Status& status) = 0;
+
+    bool accepts_writes_locked() const {
+        return !closed_ && !writes_done_requested_ && !done_;
+    }
+
+    /**
+     * @brief Queue a message; the caller must hold mutex_ via @p lock
+     *
+     * The caller must have checked accepts_writes_locked(). The lock may be
+     * released before returning.
+     */
+    void write_locked(std::unique_lock<std::mutex>& lock, RequestT message) {
+        if (write_pending_) {
+            queue_.push_back(std::move(message));
+            return;
+        }
+        write_pending_ = true;
+        current_write_ = std::move(message);
+        lock.unlock();
+        this->StartWrite(&current_write_);
+    }
+
+    mutable std::mutex mutex_;
+    std::condition_variable cv_;
+
+private:
+    // Releases the hold once nothing can start another write; unlocks @p lock
+    void release_hold(std::unique_lock<std::mutex>& lock) {
+        bool release = !hold_released_ && !write_pending_ && closed_;
+        if (release) {
+            hold_released_ = true;
+        }
+        lock.unlock();
+        if (release) {
+            this->RemoveHold();
+        }
+    }
+
+    std::unique_ptr<grpc::ClientContext> context_;
+
+    std::deque<RequestT> queue_;
+    RequestT current_write_;
+    ResponseT incoming_;
+
+    bool write_pending_ = false;
+    bool writes_done_requested_ = false;
+    bool closed_ = false;
+    bool hold_released_ = false;
+    bool done_ = false;
+    grpc::Status status_;
+};
+
+} // namespace ascnd
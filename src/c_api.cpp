@@ -0,0 +1,321 @@
+/**
+ * @file c_api.cpp
+ * @brief Implementation of the C API over the flat value API
+ */
+
+#include "ascnd/ascnd_c.h"
+#include "ascnd/client.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+struct ascnd_client {
+    explicit ascnd_client(ascnd::ClientConfig config) : client(std::move(config)) {}
+
+    ascnd::AscndClient client;
+};
+
+namespace {
+
+thread_local std::string g_last_error;
+
+int Fail(std::string message) {
+    g_last_error = std::move(message);
+    return -1;
+}
+
+// Whether a caller-compiled config includes a field
+#define ASCND_CONFIG_HAS(config, field) \
+    ((config)->struct_size >= offsetof(ascnd_config, field) + sizeof((config)->field))
+
+ascnd_string View(const std::string& text) {
+    return ascnd_string{text.c_str(), text.size()};
+}
+
+ascnd_string View(const ascnd::flat::Id& id) {
+    return ascnd_string{id.c_str(), id.size()};
+}
+
+ascnd_string View(const std::optional<std::string>& text) {
+    return text ? View(*text) : ascnd_string{"", 0};
+}
+
+ascnd_bracket View(const ascnd::flat::Bracket& bracket) {
+    return ascnd_bracket{View(bracket.id), View(bracket.name), View(bracket.color)};
+}
+
+// The views below borrow from the result and locals, so each callback is
+// invoked before they go out of scope
+
+void DeliverSubmit(ascnd_submit_callback callback, void* user_data,
+                   const ascnd::Result<ascnd::flat::SubmitResult>& result) {
+    if (result.is_error()) {
+        callback(user_data, result.error_code(), result.error().c_str(), nullptr);
+        return;
+    }
+    const ascnd::flat::SubmitResult& value = result.value();
+
+    std::vector<ascnd_violation> violations;
+    ascnd_submit_result view{};
+    view.score_id = View(value.score_id);
+    view.rank = value.rank;
+    view.is_new_best = value.is_new_best;
+    view.was_deduplicated = value.was_deduplicated;
+    view.anticheat_passed = 1;
+    view.anticheat_action = ascnd_string{"", 0};
+    if (value.anticheat) {
+        view.anticheat_passed = value.anticheat->passed;
+        view.anticheat_action = View(value.anticheat->action);
+        violations.reserve(value.anticheat->violations.size());
+        for (const auto& violation : value.anticheat->violations) {
+            violations.push_back(ascnd_violation{View(violation.flag_type), View(violation.reason)});
+        }
+    }
+    view.violations = violations.data();
+    view.violation_count = violations.size();
+    callback(user_data, 0, "", &view);
+}
+
+void DeliverLeaderboard(ascnd_leaderboard_callback callback, void* user_data,
+                        const ascnd::Result<ascnd::flat::Leaderboard>& result) {
+    if (result.is_error()) {
+        callback(user_data, result.error_code(), result.error().c_str(), nullptr);
+        return;
+    }
+    const ascnd::flat::Leaderboard& value = result.value();
+
+    std::vector<ascnd_entry> entries;
+    entries.reserve(value.entries.size());
+    for (const auto& entry : value.entries) {
+        entries.push_back(ascnd_entry{entry.score, entry.rank, entry.bracket, View(entry.player_id),
+                                      View(entry.submitted_at), View(entry.metadata)});
+    }
+    std::vector<ascnd_bracket> brackets;
+    brackets.reserve(value.brackets.size());
+    for (const auto& bracket : value.brackets) {
+        brackets.push_back(View(bracket));
+    }
+
+    ascnd_leaderboard view{};
+    view.entries = entries.data();
+    view.entry_count = entries.size();
+    view.brackets = brackets.data();
+    view.bracket_count = brackets.size();
+    view.total_entries = value.total_entries;
+    view.has_more = value.has_more;
+    view.period_start = View(value.period_start);
+    view.period_end = View(value.period_end);
+    view.view_slug = value.view ? View(value.view->slug) : ascnd_string{"", 0};
+    view.view_name = value.view ? View(value.view->name) : ascnd_string{"", 0};
+    callback(user_data, 0, "", &view);
+}
+
+void DeliverPlayerRank(ascnd_player_rank_callback callback, void* user_data,
+                       const ascnd::Result<ascnd::flat::PlayerRank>& result) {
+    if (result.is_error()) {
+        callback(user_data, result.error_code(), result.error().c_str(), nullptr);
+        return;
+    }
+    const ascnd::flat::PlayerRank& value = result.value();
+
+    ascnd_bracket bracket{};
+    ascnd_player_rank view{};
+    view.has_rank = value.rank.has_value();
+    view.rank = value.rank.value_or(0);
+    view.has_score = value.score.has_value();
+    view.score = value.score.value_or(0);
+    view.has_best_score = value.best_score.has_value();
+    view.best_score = value.best_score.value_or(0);
+    view.total_entries = value.total_entries;
+    view.percentile = View(value.percentile);
+    if (value.bracket) {
+        bracket = View(*value.bracket);
+        view.bracket = &bracket;
+    }
+    view.view_slug = value.view ? View(value.view->slug) : ascnd_string{"", 0};
+    view.view_name = value.view ? View(value.view->name) : ascnd_string{"", 0};
+    view.has_global_rank = value.global_rank.has_value();
+    view.global_rank = value.global_rank.value_or(0);
+    view.global_total_entries = value.global_total_entries.value_or(0);
+    view.global_percentile = View(value.global_percentile);
+    callback(user_data, 0, "", &view);
+}
+
+std::optional<std::string> OptionalString(const char* text) {
+    return text ? std::optional<std::string>(text) : std::nullopt;
+}
+
+}  // anonymous namespace
+
+extern "C" {
+
+void ascnd_config_defaults(ascnd_config* config) {
+    if (!config) {
+        return;
+    }
+    // Only the fields the caller compiled are written; the struct may be
+    // smaller than this library's
+    const ascnd::ClientConfig defaults;
+    if (ASCND_CONFIG_HAS(config, use_ssl)) {
+        config->use_ssl = defaults.use_ssl;
+    }
+    if (ASCND_CONFIG_HAS(config, request_timeout_ms)) {
+        config->request_timeout_ms = defaults.request_timeout_ms;
+    }
+    if (ASCND_CONFIG_HAS(config, max_retries)) {
+        config->max_retries = defaults.max_retries;
+    }
+    if (ASCND_CONFIG_HAS(config, session_mode)) {
+        config->session_mode = defaults.session_mode;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_session_resumption)) {
+        config->tls_session_resumption = defaults.tls_session_resumption;
+    }
+    if (ASCND_CONFIG_HAS(config, connection_timeout_ms)) {
+        config->connection_timeout_ms = defaults.connection_timeout_ms;
+    }
+}
+
+ascnd_client* ascnd_client_create(const ascnd_config* config) {
+    g_last_error.clear();
+    if (!config || config->struct_size == 0) {
+        Fail("config must be initialized with ascnd_config_init");
+        return nullptr;
+    }
+    if (!config->server_address || !config->api_key) {
+        Fail("server_address and api_key are required");
+        return nullptr;
+    }
+
+    ascnd::ClientConfig client_config;
+    client_config.server_address = config->server_address;
+    client_config.api_key = config->api_key;
+    if (ASCND_CONFIG_HAS(config, use_ssl)) {
+        client_config.use_ssl = config->use_ssl != 0;
+    }
+    if (ASCND_CONFIG_HAS(config, request_timeout_ms)) {
+        client_config.request_timeout_ms = config->request_timeout_ms;
+    }
+    if (ASCND_CONFIG_HAS(config, max_retries)) {
+        client_config.max_retries = config->max_retries;
+    }
+    if (ASCND_CONFIG_HAS(config, session_mode)) {
+        client_config.session_mode = config->session_mode != 0;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_session_resumption)) {
+        client_config.tls_session_resumption = config->tls_session_resumption != 0;
+    }
+    if (ASCND_CONFIG_HAS(config, connection_timeout_ms)) {
+        client_config.connection_timeout_ms = config->connection_timeout_ms;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_root_certs_pem) && config->tls_root_certs_pem) {
+        client_config.tls_root_certs_pem = config->tls_root_certs_pem;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_client_cert_pem) && config->tls_client_cert_pem) {
+        client_config.tls_client_cert_pem = config->tls_client_cert_pem;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_client_key_pem) && config->tls_client_key_pem) {
+        client_config.tls_client_key_pem = config->tls_client_key_pem;
+    }
+    if (ASCND_CONFIG_HAS(config, tls_pinned_server_cert_pem) && config->tls_pinned_server_cert_pem) {
+        client_config.tls_pinned_server_cert_pem = config->tls_pinned_server_cert_pem;
+    }
+
+    try {
+        return new ascnd_client(std::move(client_config));
+    } catch (const std::exception& e) {
+        Fail(e.what());
+        return nullptr;
+    }
+}
+
+void ascnd_client_destroy(ascnd_client* client) {
+    delete client;
+}
+
+const char* ascnd_last_error(void) {
+    return g_last_error.c_str();
+}
+
+int ascnd_submit_score(ascnd_client* client, const ascnd_submission* submission,
+                       ascnd_submit_callback callback, void* user_data) {
+    g_last_error.clear();
+    if (!client || !submission || !callback || !submission->leaderboard_id || !submission->player_id) {
+        return Fail("client, submission, leaderboard_id, player_id and callback are required");
+    }
+
+    ascnd::flat::ScoreSubmission request;
+    request.leaderboard_id = submission->leaderboard_id;
+    request.player_id = submission->player_id;
+    request.score = submission->score;
+    if (submission->metadata) {
+        request.metadata.emplace(submission->metadata, submission->metadata_size);
+    }
+    request.idempotency_key = OptionalString(submission->idempotency_key);
+
+    try {
+        client->client.submit_score_async(request, [callback, user_data](const auto& result) {
+            DeliverSubmit(callback, user_data, result);
+        });
+    } catch (const std::exception& e) {
+        return Fail(e.what());
+    }
+    return 0;
+}
+
+int ascnd_get_leaderboard(ascnd_client* client, const ascnd_leaderboard_query* query,
+                          ascnd_leaderboard_callback callback, void* user_data) {
+    g_last_error.clear();
+    if (!client || !query || !callback || !query->leaderboard_id) {
+        return Fail("client, query, leaderboard_id and callback are required");
+    }
+
+    ascnd::flat::LeaderboardQuery request;
+    request.leaderboard_id = query->leaderboard_id;
+    if (query->limit > 0) {
+        request.limit = query->limit;
+    }
+    if (query->offset > 0) {
+        request.offset = query->offset;
+    }
+    request.period = OptionalString(query->period);
+    request.view_slug = OptionalString(query->view_slug);
+
+    try {
+        client->client.get_leaderboard_async(request, [callback, user_data](const auto& result) {
+            DeliverLeaderboard(callback, user_data, result);
+        });
+    } catch (const std::exception& e) {
+        return Fail(e.what());
+    }
+    return 0;
+}
+
+int ascnd_get_player_rank(ascnd_client* client, const ascnd_player_rank_query* query,
+                          ascnd_player_rank_callback callback, void* user_data) {
+    g_last_error.clear();
+    if (!client || !query || !callback || !query->leaderboard_id || !query->player_id) {
+        return Fail("client, query, leaderboard_id, player_id and callback are required");
+    }
+
+    ascnd::flat::PlayerRankQuery request;
+    request.leaderboard_id = query->leaderboard_id;
+    request.player_id = query->player_id;
+    request.period = OptionalString(query->period);
+    request.view_slug = OptionalString(query->view_slug);
+
+    try {
+        client->client.get_player_rank_async(request, [callback, user_data](const auto& result) {
+            DeliverPlayerRank(callback, user_data, result);
+        });
+    } catch (const std::exception& e) {
+        return Fail(e.what());
+    }
+    return 0;
+}
+
+}  // extern "C"
@@ -4,15 +4,38 @@
  */
 
 #include "ascnd/client.hpp"
+#include "ascnd.grpc.pb.h"
+#include "batch_window.hpp"
+#include "best_score_cache.hpp"
+#include "flat_convert.hpp"
+#include "player_rank_cache.hpp"
+#include "rank_batcher.hpp"
+#include "score_validator.hpp"
+#include "session.hpp"
+#include "striped_counters.hpp"
+#include "submission_throttle.hpp"
+#include "thread_affinity.hpp"
 
 #include <grpcpp/grpcpp.h>
+#include <grpcpp/generic/generic_stub.h>
+#include <grpcpp/security/tls_certificate_provider.h>
+#include <grpcpp/security/tls_certificate_verifier.h>
+#include <grpcpp/security/tls_credentials_options.h>
+#include <grpc/grpc_security.h>
 #include <glog/logging.h>
 
 #include <algorithm>
 #include <atomic>
+#include <cctype>
+#include <condition_variable>
 #include <future>
+#include <map>
 #include <mutex>
+#include <set>
+#include <sstream>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 namespace ascnd {
 
@@ -82,24 +105,346 @@ void ShutdownLogging() {
     }
 }
 
+// ============================================================================
+// Shared Transport State
+// ============================================================================
+
+namespace {
+
+// Number of TLS sessions kept for resumption (one per server name)
+constexpr size_t kSslSessionCacheCapacity = 64;
+
+// Extract the base64 body of a PEM certificate so that certificates can be
+// compared regardless of line endings or surrounding whitespace.
+std::string NormalizePem(const std::string& pem) {
+    std::string normalized;
+    normalized.reserve(pem.size());
+    bool in_body = false;
+    size_t pos = 0;
+    while (pos < pem.size()) {
+        size_t end = pem.find('\n', pos);
+        if (end == std::string::npos) {
+            end = pem.size();
+        }
+        std::string line = pem.substr(pos, end - pos);
+        pos = end + 1;
+        if (line.compare(0, 5, "-----") == 0) {
+            in_body = line.find("BEGIN") != std::string::npos;
+            continue;
+        }
+        if (in_body) {
+            for (char c : line) {
+                if (!std::isspace(static_cast<unsigned char>(c))) {
+                    normalized.push_back(c);
+                }
+            }
+        }
+    }
+    return normalized;
+}
+
+// Accepts the server only if it presents exactly the pinned certificate.
+class PinnedCertificateVerifier : public grpc::experimental::ExternalCertificateVerifier {
+public:
+    explicit PinnedCertificateVerifier(const std::string& pinned_pem)
+        : pinned_(NormalizePem(pinned_pem)) {}
+
+    bool Verify(grpc::experimental::TlsCustomVerificationCheckRequest* request,
+                std::function<void(grpc::Status)> /*callback*/,
+                grpc::Status* sync_status) override {
+        grpc::string_ref peer = request->peer_cert();
+        if (NormalizePem(std::string(peer.data(), peer.size())) == pinned_) {
+            *sync_status = grpc::Status::OK;
+        } else {
+            LOG(ERROR) << "Server certificate does not match the pinned certificate";
+            *sync_status = grpc::Status(grpc::StatusCode::UNAUTHENTICATED,
+                                        "Server certificate does not match the pinned certificate");
+        }
+        return true;  // Verification completed synchronously
+    }
+
+    void Cancel(grpc::experimental::TlsCustomVerificationCheckRequest* /*request*/) override {}
+
+private:
+    std::string pinned_;
+};
+
+std::shared_ptr<grpc::ChannelCredentials> BuildSslCredentials(const ClientConfig& config) {
+    if (config.tls_pinned_server_cert_pem.empty()) {
+        grpc::SslCredentialsOptions options;
+        options.pem_root_certs = config.tls_root_certs_pem;
+        options.pem_private_key = config.tls_client_key_pem;
+        options.pem_cert_chain = config.tls_client_cert_pem;
+        return grpc::SslCredentials(options);
+    }
+
+    // Pinning needs a custom verifier, which only the TLS credentials API offers.
+    // The pin is the trust anchor, so CA chain verification only runs when
+    // explicit roots are configured as well.
+    std::vector<grpc::experimental::IdentityKeyCertPair> identity;
+    if (!config.tls_client_cert_pem.empty()) {
+        identity.push_back({config.tls_client_key_pem, config.tls_client_cert_pem});
+    }
+
+    grpc::experimental::TlsChannelCredentialsOptions options;
+    if (!config.tls_root_certs_pem.empty() || !identity.empty()) {
+        options.set_certificate_provider(
+            std::make_shared<grpc::experimental::StaticDataCertificateProvider>(
+                config.tls_root_certs_pem, identity));
+        if (!config.tls_root_certs_pem.empty()) {
+            options.watch_root_certs();
+        }
+        if (!identity.empty()) {
+            options.watch_identity_key_cert_pairs();
+        }
+    }
+    options.set_verify_server_certs(!config.tls_root_certs_pem.empty());
+    options.set_check_call_host(false);
+    options.set_certificate_verifier(
+        grpc::experimental::ExternalCertificateVerifier::Create<PinnedCertificateVerifier>(
+            config.tls_pinned_server_cert_pem));
+    return grpc::experimental::TlsCredentials(options);
+}
+
+// SSL credentials are immutable and thread-safe, so each distinct TLS
+// configuration is built once per process and shared by every client using
+// it, instead of re-parsing PEM data (or re-reading the root store) per
+// channel.
+std::shared_ptr<grpc::ChannelCredentials> SharedSslCredentials(const ClientConfig& config) {
+    using Key = std::tuple<std::string, std::string, std::string, std::string>;
+    static std::mutex cache_mutex;
+    static std::map<Key, std::shared_ptr<grpc::ChannelCredentials>> cache;
+
+    Key key{config.tls_root_certs_pem, config.tls_client_cert_pem,
+            config.tls_client_key_pem, config.tls_pinned_server_cert_pem};
+
+    std::lock_guard<std::mutex> lock(cache_mutex);
+    auto& credentials = cache[key];
+    if (!credentials) {
+        credentials = BuildSslCredentials(config);
+    }
+    return credentials;
+}
+
+// Process-wide TLS session cache. Channels carrying it resume sessions from
+// cached tickets, so reconnects and additional channels to the same server
+// skip the full handshake. Intentionally never destroyed.
+grpc_ssl_session_cache* SharedSslSessionCache() {
+    static grpc_ssl_session_cache* const cache =
+        grpc_ssl_session_cache_create_lru(kSslSessionCacheCapacity);
+    return cache;
+}
+
+}  // anonymous namespace
+
+std::shared_ptr<grpc::Channel> CreateChannel(const ClientConfig& config) {
+    std::shared_ptr<grpc::ChannelCredentials> creds;
+
+    if (config.use_ssl) {
+        VLOG(1) << "Creating SSL channel to " << config.server_address;
+        creds = SharedSslCredentials(config);
+    } else if (config.is_unix_socket()) {
+        VLOG(1) << "Creating Unix domain socket channel to " << config.server_address;
+        creds = grpc::InsecureChannelCredentials();
+    } else {
+        LOG(WARNING) << "Creating insecure channel to " << config.server_address
+                     << " (SSL disabled)";
+        creds = grpc::InsecureChannelCredentials();
+    }
+
+    // Set channel arguments
+    grpc::ChannelArguments args;
+
+    if (!config.user_agent.empty()) {
+        args.SetUserAgentPrefix(config.user_agent);
+    } else {
+        args.SetUserAgentPrefix("ascnd-cpp-client/1.0.0");
+    }
+
+    if (config.use_ssl && config.tls_session_resumption) {
+        grpc_arg cache_arg = grpc_ssl_session_cache_create_channel_arg(SharedSslSessionCache());
+        args.SetPointerWithVtable(cache_arg.key, cache_arg.value.pointer.p,
+                                  cache_arg.value.pointer.vtable);
+    }
+
+    // gRPC reuses the connection of any channel with identical arguments
+    // unless the channel keeps its subchannels to itself
+    if (config.dedicated_connection) {
+        args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+    }
+
+    return grpc::CreateCustomChannel(config.server_address, creds, args);
+}
+
+// ============================================================================
+// Session Message Mapping
+// ============================================================================
+
+namespace {
+
+void SetSessionRequest(::ascnd::v1::SessionRequest* message, const SubmitScoreRequest& request) {
+    *message->mutable_submit_score() = request;
+}
+
+void SetSessionRequest(::ascnd::v1::SessionRequest* message, const GetLeaderboardRequest& request) {
+    *message->mutable_get_leaderboard() = request;
+}
+
+void SetSessionRequest(::ascnd::v1::SessionRequest* message, const GetPlayerRankRequest& request) {
+    *message->mutable_get_player_rank() = request;
+}
+
+grpc::Status MismatchedSessionResponse() {
+    return grpc::Status(grpc::StatusCode::INTERNAL, "Session response does not match request type");
+}
+
+grpc::Status TakeSessionResponse(::ascnd::v1::SessionResponse* message, SubmitScoreResponse* response) {
+    if (!message->has_submit_score()) {
+        return MismatchedSessionResponse();
+    }
+    response->Swap(message->mutable_submit_score());
+    return grpc::Status::OK;
+}
+
+grpc::Status TakeSessionResponse(::ascnd::v1::SessionResponse* message, GetLeaderboardResponse* response) {
+    if (!message->has_get_leaderboard()) {
+        return MismatchedSessionResponse();
+    }
+    response->Swap(message->mutable_get_leaderboard());
+    return grpc::Status::OK;
+}
+
+grpc::Status TakeSessionResponse(::ascnd::v1::SessionResponse* message, GetPlayerRankResponse* response) {
+    if (!message->has_get_player_rank()) {
+        return MismatchedSessionResponse();
+    }
+    response->Swap(message->mutable_get_player_rank());
+    return grpc::Status::OK;
+}
+
+}  // anonymous namespace
+
 // ============================================================================
 // Client Implementation
 // ============================================================================
 
 class AscndClient::Impl {
 public:
+    // Guards config only; requests snapshot what they need and run unlocked
     ClientConfig config;
+    mutable std::mutex mutex;
+
+    // CPUs for async request threads and for gRPC completion threads; null
+    // when the threads are left unpinned. Declared, like the counters, ahead
+    // of the channel and session so that they outlive completions arriving
+    // while those are torn down.
+    std::unique_ptr<ThreadPinner> callback_pinner;
+    std::unique_ptr<ThreadPinner> completion_pinner;
+
+    static_assert(BatchWindow::kBuckets == BatchHistogram::kBuckets, "histogram bucket counts differ");
+
+    // Activity counters reported by stats(). They are bumped by every
+    // request thread, so each thread writes to a cache line of its own.
+    enum Counter : size_t {
+        kSubmissionsRejectedLocally,
+        kSubmissionsFlaggedLocally,
+        kSubmissionsDelayed,
+        kSubmissionsThrottled,
+        kSubmissionsSkipped,
+        kSubmissionsBatched,
+        kSubmissionsLost,
+        kPlayerRankCacheHits,
+        kPlayerRankBatches,
+        kPlayerRanksBatched,
+        kRequestsSent,
+        kRequestsFailed,
+        // Histograms, one counter per bucket
+        kRankBatchWindows,
+        kRankBatchSizes = kRankBatchWindows + BatchHistogram::kBuckets,
+        kSubmitBatchWindows = kRankBatchSizes + BatchHistogram::kBuckets,
+        kSubmitBatchSizes = kSubmitBatchWindows + BatchHistogram::kBuckets,
+        kCounterCount = kSubmitBatchSizes + BatchHistogram::kBuckets
+    };
+    StripedCounters<kCounterCount> counters;
+
+    // Channel and stub are created on first use (see ensure_channel) so that
+    // constructing a client never pays for credential or channel setup.
     std::shared_ptr<grpc::Channel> channel;
     std::unique_ptr<::ascnd::v1::AscndService::Stub> stub;
-    mutable std::mutex mutex;
+    std::once_flag channel_once;
+
+    // Byte-level stub for calls whose responses are never parsed
+    std::unique_ptr<grpc::GenericStub> generic_stub;
+    static constexpr char kSubmitScoreMethod[] = "/ascnd.v1.AscndService/SubmitScore";
+
+    // Multiplexed stream used instead of unary calls in session mode. Set
+    // once, under mutex, during channel setup; code that has not gone
+    // through ensure_channel() must read it under mutex too.
+    std::unique_ptr<Session> session;
 
     // Track pending async operations for proper cleanup
     std::vector<std::future<void>> pending_operations;
     std::mutex pending_mutex;
 
-    explicit Impl(ClientConfig cfg) : config(std::move(cfg)) {
+    // Fire-and-forget calls run on gRPC's callback threads rather than as
+    // futures, so they are counted instead (guarded by pending_mutex)
+    int fire_and_forget_calls = 0;
+    std::condition_variable fire_and_forget_done;
+
+    // Leaderboard rules and per-player history for local validation
+    ScoreValidator validator;
+
+    // Leaderboards whose rules are being fetched. Other threads missing the
+    // cache for one of them wait for that fetch instead of issuing their own.
+    std::set<std::string> rules_fetching;
+    std::mutex rules_fetch_mutex;
+    std::condition_variable rules_fetched;
+
+    // Per-player submission limit; null when throttling is disabled
+    std::unique_ptr<SubmissionThrottle> throttle;
+
+    // Known best scores, and non-improving submissions awaiting a batch
+    BestScoreCache best_scores;
+    static constexpr size_t kMaxDeferredBatch = 100;
+    static constexpr int kMaxDeferredAttempts = 3;  // Flushes before giving up
+    struct DeferredSubmission {
+        SubmitScoreRequest request;
+        StatusCallback callback;  // Fire-and-forget callback awaiting the outcome
+        int attempts = 0;         // Failed batches it was part of
+    };
+    std::mutex deferred_mutex;
+    std::condition_variable deferred_cv;
+    std::vector<DeferredSubmission> deferred;
+    BatchWindow::Clock::time_point deferred_flush_at;  // When the queued batch is due
+    BatchWindow::Clock::duration deferred_window{};    // Window chosen for it
+    bool deferred_stopping = false;
+    std::thread deferred_flusher;  // Runs while batching; joined in ~Impl
+
+    // Wait before sending deferred submissions; null unless batching them
+    std::unique_ptr<BatchWindow> submit_window;
+
+    // Recent GetPlayerRank responses; null when reuse is disabled
+    std::unique_ptr<PlayerRankCache> rank_cache;
+
+    // Coalesces concurrent GetPlayerRank calls; null when batching is disabled
+    std::unique_ptr<RankBatcher> rank_batcher;
+
+    // View metadata seen in responses, by (leaderboard, view slug)
+    std::map<std::pair<std::string, std::string>, ViewInfo> views;
+    mutable std::mutex views_mutex;
+
+    explicit Impl(ClientConfig cfg, std::shared_ptr<grpc::Channel> existing_channel = nullptr)
+        : config(std::move(cfg)) {
+        if (existing_channel && config.server_address.empty()) {
+            config.server_address = "in-process";
+        }
         config.validate();  // Throws std::invalid_argument on invalid config
 
+        // Same-host transports skip TLS entirely
+        if (existing_channel || config.is_unix_socket()) {
+            config.use_ssl = false;
+        }
+
         // Auto-initialize logging if not already done
         EnsureLoggingInitialized();
 
@@ -110,18 +455,80 @@ public:
         }
 
         LOG(INFO) << "Initializing Ascnd client for " << config.server_address;
-        init_channel();
+
+        if (config.player_rank_cache_ms > 0) {
+            rank_cache = std::make_unique<PlayerRankCache>(
+                std::chrono::milliseconds(config.player_rank_cache_ms));
+        }
+
+        if (config.player_rank_batch_window_ms > 0) {
+            rank_batcher = std::make_unique<RankBatcher>(
+                std::chrono::milliseconds(config.player_rank_batch_window_ms), config.adaptive_batching,
+                [this](const GetPlayerRankRequest& request) { return fetch_rank(request); },
+                [this](const GetPlayerRanksRequest& request) { return fetch_ranks(request); },
+                [this](BatchWindow::Clock::duration window, size_t size) {
+                    record_batch(kRankBatchWindows, kRankBatchSizes, window, size);
+                });
+        }
+
+        if (config.best_score_filter == BestScoreFilter::kBatch) {
+            submit_window = std::make_unique<BatchWindow>(
+                std::chrono::milliseconds(config.best_score_batch_delay_ms), config.adaptive_batching);
+        }
+
+        if (config.player_submission_limit > 0) {
+            throttle = std::make_unique<SubmissionThrottle>(
+                config.player_submission_limit,
+                std::chrono::milliseconds(config.player_submission_window_ms));
+        }
+
+        callback_pinner = make_pinner(config.callback_thread_affinity);
+        completion_pinner = make_pinner(config.completion_thread_affinity);
+
+        if (existing_channel) {
+            std::call_once(channel_once, [this, &existing_channel]() {
+                channel = std::move(existing_channel);
+                init_stubs();
+            });
+        }
+
+        if (submit_window) {
+            deferred_flusher = std::thread([this]() { run_deferred_flusher(); });
+        }
+    }
+
+    static std::unique_ptr<ThreadPinner> make_pinner(const ThreadAffinity& affinity) {
+        if (affinity.empty()) {
+            return nullptr;
+        }
+        auto pinner = std::make_unique<ThreadPinner>(affinity);
+        return pinner->enabled() ? std::move(pinner) : nullptr;
+    }
+
+    // Called first thing on threads that run async requests
+    void pin_callback_thread() const {
+        if (callback_pinner) {
+            callback_pinner->pin_current_thread();
+        }
+    }
+
+    // Called whenever a gRPC thread runs this client's completion code
+    void pin_completion_thread() const {
+        if (completion_pinner) {
+            completion_pinner->pin_current_thread();
+        }
     }
 
     ~Impl() {
         VLOG(1) << "Shutting down Ascnd client";
         wait_for_pending();
+        stop_deferred_flusher();
         VLOG(1) << "Client shutdown complete";
     }
 
     // Wait for all pending async operations to complete
     void wait_for_pending() {
-        std::lock_guard<std::mutex> lock(pending_mutex);
+        std::unique_lock<std::mutex> lock(pending_mutex);
         if (!pending_operations.empty()) {
             VLOG(1) << "Waiting for " << pending_operations.size()
                     << " pending async operations";
@@ -136,6 +543,616 @@ public:
             }
         }
         pending_operations.clear();
+
+        if (fire_and_forget_calls > 0) {
+            VLOG(1) << "Waiting for " << fire_and_forget_calls << " fire-and-forget submissions";
+        }
+        fire_and_forget_done.wait(lock, [this]() { return fire_and_forget_calls == 0; });
+    }
+
+    // Send everything still deferred and end the flusher thread
+    void stop_deferred_flusher() {
+        {
+            std::lock_guard<std::mutex> lock(deferred_mutex);
+            if (!deferred.empty()) {
+                VLOG(1) << "Flushing " << deferred.size() << " deferred submissions";
+            }
+            deferred_stopping = true;
+        }
+        deferred_cv.notify_all();
+        if (deferred_flusher.joinable()) {
+            deferred_flusher.join();
+        }
+    }
+
+    // Submit without parsing the response. The request asks the server to
+    // omit the response body, and the generic stub hands back raw bytes, so
+    // nothing is deserialized even if an older server ignores the hint.
+    // Never blocks the caller: throttled submissions fail at once and
+    // missing rules are fetched in the background.
+    void submit_fire_and_forget(const SubmitScoreRequest& request, StatusCallback callback) {
+        struct Call {
+            std::unique_ptr<grpc::ClientContext> context;
+            grpc::ByteBuffer request;
+            grpc::ByteBuffer response;
+            StatusCallback callback;
+        };
+
+        grpc::Status verdict = admit(request, /*may_block=*/false);
+        if (!verdict.ok()) {
+            report_status(callback, verdict);
+            return;
+        }
+        if (filter_non_improving(request, &callback, /*may_block=*/false)) {
+            report_status(callback, grpc::Status::OK);  // Empty if deferred
+            return;
+        }
+        forget_ranks(request);
+
+        ensure_channel();
+        auto call = std::make_unique<Call>();
+        call->context = create_context(call_options());
+        call->callback = std::move(callback);
+
+        SubmitScoreRequest minimal = request;
+        minimal.set_omit_response(true);
+        bool own_buffer = false;
+        grpc::Status serialized = grpc::SerializationTraits<SubmitScoreRequest>::Serialize(
+            minimal, &call->request, &own_buffer);
+        if (!serialized.ok()) {
+            report_status(call->callback, serialized);
+            return;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(pending_mutex);
+            ++fire_and_forget_calls;
+        }
+
+        Call* raw = call.release();
+        counters.add(kRequestsSent);
+        generic_stub->UnaryCall(
+            raw->context.get(), kSubmitScoreMethod, grpc::StubOptions(), &raw->request, &raw->response,
+            [this, raw](grpc::Status status) {
+                pin_completion_thread();
+                std::unique_ptr<Call> finished(raw);
+                if (!status.ok()) {
+                    counters.add(kRequestsFailed);
+                    LOG(WARNING) << "Fire-and-forget submission failed: " << status.error_message()
+                                 << " (code: " << static_cast<int>(status.error_code()) << ")";
+                }
+                report_status(finished->callback, status);
+                finished.reset();
+
+                std::lock_guard<std::mutex> lock(pending_mutex);
+                --fire_and_forget_calls;
+                fire_and_forget_done.notify_all();
+            });
+    }
+
+    Result<SubmitScoreResponse> submit(const SubmitScoreRequest& request) {
+        grpc::Status verdict = admit(request);
+        if (!verdict.ok()) {
+            return Result<SubmitScoreResponse>::error(verdict.error_message(),
+                                                      static_cast<int>(verdict.error_code()));
+        }
+        if (filter_non_improving(request, nullptr)) {
+            return Result<SubmitScoreResponse>::ok(SubmitScoreResponse());
+        }
+        auto result = send_submission(request);
+        forget_ranks(request);
+        if (result.is_ok()) {
+            remember_submission(request, result.value());
+        }
+        return result;
+    }
+
+    Result<SubmitScoreResponse> send_submission(const SubmitScoreRequest& request) {
+        return make_request<SubmitScoreRequest, SubmitScoreResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const SubmitScoreRequest& req, SubmitScoreResponse* resp) {
+                return invoke(ctx, req, resp, &::ascnd::v1::AscndService::Stub::SubmitScore);
+            }
+        );
+    }
+
+    Result<GetLeaderboardResponse> get_leaderboard(const GetLeaderboardRequest& request) {
+        auto result = make_request<GetLeaderboardRequest, GetLeaderboardResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const GetLeaderboardRequest& req, GetLeaderboardResponse* resp) {
+                return invoke(ctx, req, resp, &::ascnd::v1::AscndService::Stub::GetLeaderboard);
+            }
+        );
+        if (result.is_ok() && result.value().has_view()) {
+            remember_view(request.leaderboard_id(), result.value().view());
+        }
+        return result;
+    }
+
+    // Answered from a recent response if possible: identical requests, and
+    // requests without a view whose player was just queried in some view
+    Result<GetPlayerRankResponse> get_player_rank(const GetPlayerRankRequest& request) {
+        GetPlayerRankResponse cached;
+        if (rank_cache && rank_cache->lookup(request, PlayerRankCache::Clock::now(), &cached)) {
+            VLOG(1) << "Answered rank of " << request.player_id() << " on "
+                    << request.leaderboard_id() << " from a recent response";
+            counters.add(kPlayerRankCacheHits);
+            return Result<GetPlayerRankResponse>::ok(std::move(cached));
+        }
+
+        // A submission while the lookup is in flight makes its response stale
+        uint64_t generation = rank_cache
+            ? rank_cache->generation(request.leaderboard_id(), request.player_id())
+            : 0;
+        auto result = rank_batcher ? rank_batcher->get(request) : fetch_rank(request);
+        if (result.is_ok()) {
+            remember_rank(request, result.value());
+            if (result.value().has_view()) {
+                remember_view(request.leaderboard_id(), result.value().view());
+            }
+            if (rank_cache) {
+                rank_cache->store(request, result.value(), PlayerRankCache::Clock::now(), generation);
+            }
+        }
+        return result;
+    }
+
+    Result<GetPlayerRankResponse> fetch_rank(const GetPlayerRankRequest& request) {
+        return make_request<GetPlayerRankRequest, GetPlayerRankResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const GetPlayerRankRequest& req, GetPlayerRankResponse* resp) {
+                return invoke(ctx, req, resp, &::ascnd::v1::AscndService::Stub::GetPlayerRank);
+            }
+        );
+    }
+
+    Result<GetPlayerRanksResponse> fetch_ranks(const GetPlayerRanksRequest& request) {
+        counters.add(kPlayerRankBatches);
+        counters.add(kPlayerRanksBatched, static_cast<uint64_t>(request.player_ids_size()));
+        return make_request<GetPlayerRanksRequest, GetPlayerRanksResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const GetPlayerRanksRequest& req, GetPlayerRanksResponse* resp) {
+                return get_stub().GetPlayerRanks(ctx, req, resp);
+            }
+        );
+    }
+
+    // A submission may change the player's rank
+    void forget_ranks(const SubmitScoreRequest& request) {
+        if (rank_cache) {
+            rank_cache->invalidate(request.leaderboard_id(), request.player_id());
+        }
+    }
+
+    Result<SubmitScoreBatchResponse> submit_batch(const SubmitScoreBatchRequest& request) {
+        auto result = make_request<SubmitScoreBatchRequest, SubmitScoreBatchResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const SubmitScoreBatchRequest& req, SubmitScoreBatchResponse* resp) {
+                return get_stub().SubmitScoreBatch(ctx, req, resp);
+            }
+        );
+        for (const auto& submission : request.submissions()) {
+            forget_ranks(submission);
+        }
+        return result;
+    }
+
+    void remember_view(const std::string& leaderboard_id, const ViewInfo& view) {
+        std::lock_guard<std::mutex> lock(views_mutex);
+        views[std::make_pair(leaderboard_id, view.slug())] = view;
+    }
+
+    // Handle a submission locally if it cannot beat the player's best score.
+    // Returns false if it must be sent. Runs after admit(), so skipped and
+    // deferred submissions are throttled and validated like any other. A
+    // deferred submission takes over *callback, to be told its outcome.
+    bool filter_non_improving(const SubmitScoreRequest& request, StatusCallback* callback,
+                              bool may_block = true) {
+        // Only the API key changes after construction, so no lock is needed here
+        const BestScoreFilter filter = config.best_score_filter;
+        if (filter == BestScoreFilter::kOff) {
+            return false;
+        }
+
+        auto rules = rules_for(request.leaderboard_id(), may_block);
+        if (!rules || best_scores.may_improve(request.leaderboard_id(), request.player_id(),
+                                              request.score(), *rules,
+                                              BestScoreCache::Clock::now())) {
+            return false;
+        }
+
+        if (filter == BestScoreFilter::kSkip) {
+            VLOG(1) << "Skipping non-improving submission for " << request.player_id()
+                    << " on " << request.leaderboard_id();
+            counters.add(kSubmissionsSkipped);
+        } else {
+            VLOG(1) << "Deferring non-improving submission for " << request.player_id()
+                    << " on " << request.leaderboard_id();
+            counters.add(kSubmissionsBatched);
+            defer(request, callback ? std::move(*callback) : nullptr);
+        }
+        return true;
+    }
+
+    // Learn from a submission the server accepted
+    void remember_submission(const SubmitScoreRequest& request, const SubmitScoreResponse& response) {
+        if (config.best_score_filter == BestScoreFilter::kOff) {
+            return;
+        }
+        // Scores withheld by anticheat do not count towards the player's best
+        if (response.has_anticheat() && (response.anticheat().action() == "reject" ||
+                                         response.anticheat().action() == "shadow_ban")) {
+            return;
+        }
+        remember_best(request.leaderboard_id(), request.player_id(), request.score());
+    }
+
+    // Learn from the best score reported for the current period
+    void remember_rank(const GetPlayerRankRequest& request, const GetPlayerRankResponse& response) {
+        if (config.best_score_filter == BestScoreFilter::kOff || !response.has_best_score() ||
+            request.has_view_slug() || (request.has_period() && request.period() != "current")) {
+            return;
+        }
+        remember_best(request.leaderboard_id(), request.player_id(), response.best_score());
+    }
+
+    void remember_best(const std::string& leaderboard_id, const std::string& player_id, int64_t score) {
+        auto rules = rules_for(leaderboard_id);
+        if (!rules) {
+            return;
+        }
+        best_scores.record(leaderboard_id, player_id, score, *rules, BestScoreCache::Clock::now());
+    }
+
+    // Queue a non-improving submission; the first one of a batch opens the
+    // submit window, after which the flusher thread sends the batch
+    void defer(const SubmitScoreRequest& request, StatusCallback callback) {
+        std::lock_guard<std::mutex> lock(deferred_mutex);
+        auto now = BatchWindow::Clock::now();
+        submit_window->arrived(now);
+        if (deferred.empty()) {
+            deferred_window = submit_window->next();
+            deferred_flush_at = now + deferred_window;
+        }
+        deferred.push_back(DeferredSubmission{request, std::move(callback)});
+        if (deferred.size() == 1 || deferred.size() >= kMaxDeferredBatch) {
+            deferred_cv.notify_all();
+        }
+    }
+
+    // Body of deferred_flusher: sends each batch when its window closes or
+    // it fills up, and everything left once the client shuts down
+    void run_deferred_flusher() {
+        pin_callback_thread();
+        std::unique_lock<std::mutex> lock(deferred_mutex);
+        while (true) {
+            deferred_cv.wait(lock, [this]() { return deferred_stopping || !deferred.empty(); });
+            if (deferred.empty()) {
+                return;
+            }
+            deferred_cv.wait_until(lock, deferred_flush_at, [this]() {
+                return deferred_stopping || deferred.size() >= kMaxDeferredBatch;
+            });
+
+            std::vector<DeferredSubmission> batch;
+            batch.swap(deferred);
+            const auto window = deferred_window;
+            lock.unlock();
+            std::vector<DeferredSubmission> failed;
+            for (size_t begin = 0; begin < batch.size(); begin += kMaxDeferredBatch) {
+                size_t end = std::min(batch.size(), begin + kMaxDeferredBatch);
+                record_batch(kSubmitBatchWindows, kSubmitBatchSizes, window, end - begin);
+                send_deferred(batch.begin() + begin, batch.begin() + end, &failed);
+            }
+            lock.lock();
+            requeue_deferred(std::move(failed));
+        }
+    }
+
+    // Put submissions whose batch failed transiently back at the head of the
+    // queue, to be sent again after another best_score_batch_delay_ms.
+    // Called with deferred_mutex held.
+    void requeue_deferred(std::vector<DeferredSubmission> failed) {
+        if (failed.empty()) {
+            return;
+        }
+        VLOG(1) << "Retrying " << failed.size() << " deferred submissions later";
+        auto flush_at = BatchWindow::Clock::now() + std::chrono::milliseconds(config.best_score_batch_delay_ms);
+        if (deferred.empty() || flush_at < deferred_flush_at) {
+            deferred_flush_at = flush_at;
+        }
+        failed.insert(failed.end(), std::make_move_iterator(deferred.begin()),
+                      std::make_move_iterator(deferred.end()));
+        deferred = std::move(failed);
+    }
+
+    void record_batch(Counter windows, Counter sizes, BatchWindow::Clock::duration window, size_t size) {
+        counters.add(windows + BatchWindow::window_bucket(window));
+        counters.add(sizes + BatchWindow::size_bucket(size));
+    }
+
+    BatchHistogram histogram(Counter first) const {
+        BatchHistogram histogram;
+        for (size_t i = 0; i < BatchHistogram::kBuckets; ++i) {
+            histogram.counts[i] = counters.sum(first + i);
+        }
+        return histogram;
+    }
+
+    // Send one batch of deferred submissions and report each outcome.
+    // Submissions of a batch that failed transiently go to *failed unless
+    // they have been tried kMaxDeferredAttempts times; others are lost.
+    void send_deferred(std::vector<DeferredSubmission>::iterator begin,
+                       std::vector<DeferredSubmission>::iterator end,
+                       std::vector<DeferredSubmission>* failed) {
+        SubmitScoreBatchRequest request;
+        for (auto it = begin; it != end; ++it) {
+            *request.add_submissions() = it->request;
+        }
+
+        auto start = BatchWindow::Clock::now();
+        auto result = make_request<SubmitScoreBatchRequest, SubmitScoreBatchResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const SubmitScoreBatchRequest& req, SubmitScoreBatchResponse* resp) {
+                return get_stub().SubmitScoreBatch(ctx, req, resp);
+            }
+        );
+        submit_window->completed(BatchWindow::Clock::now() - start);
+        if (result.is_ok()) {
+            const auto& results = result.value().results();
+            for (auto it = begin; it != end; ++it) {
+                int i = static_cast<int>(it - begin);
+                grpc::Status status(grpc::StatusCode::INTERNAL, "SubmitScoreBatch returned too few results");
+                if (i < results.size() && results[i].has_response()) {
+                    remember_submission(it->request, results[i].response());
+                    status = grpc::Status::OK;
+                } else if (i < results.size()) {
+                    status = grpc::Status(static_cast<grpc::StatusCode>(results[i].error_code()),
+                                          results[i].error_message());
+                }
+                finish_deferred(*it, status);
+            }
+            return;
+        }
+
+        if (result.error_code() == static_cast<int>(grpc::StatusCode::UNIMPLEMENTED)) {
+            VLOG(1) << "Server does not support batches; sending deferred submissions one by one";
+            for (auto it = begin; it != end; ++it) {
+                auto submitted = send_submission(it->request);
+                if (submitted.is_ok()) {
+                    remember_submission(it->request, submitted.value());
+                    finish_deferred(*it, grpc::Status::OK);
+                } else {
+                    finish_deferred(*it, grpc::Status(static_cast<grpc::StatusCode>(submitted.error_code()),
+                                                      submitted.error()));
+                }
+            }
+            return;
+        }
+
+        const bool retryable = is_retryable_error(static_cast<grpc::StatusCode>(result.error_code()));
+        for (auto it = begin; it != end; ++it) {
+            if (retryable && ++it->attempts < kMaxDeferredAttempts) {
+                failed->push_back(std::move(*it));
+            } else {
+                finish_deferred(*it, grpc::Status(static_cast<grpc::StatusCode>(result.error_code()),
+                                                  result.error()));
+            }
+        }
+    }
+
+    // Report a deferred submission's final outcome
+    void finish_deferred(const DeferredSubmission& submission, const grpc::Status& status) {
+        if (!status.ok()) {
+            counters.add(kSubmissionsLost);
+            LOG(ERROR) << "Lost deferred submission for " << submission.request.player_id() << " on "
+                       << submission.request.leaderboard_id() << ": " << status.error_message()
+                       << " (code: " << static_cast<int>(status.error_code()) << ")";
+        }
+        report_status(submission.callback, status);
+    }
+
+    // Local checks a submission must pass before it is sent. Unless
+    // may_block, a throttled submission fails at once whatever the throttle
+    // mode, and a submission whose rules are not cached is not checked.
+    grpc::Status admit(const SubmitScoreRequest& request, bool may_block = true) {
+        grpc::Status status = throttle_submission(request, may_block);
+        if (!status.ok()) {
+            return status;
+        }
+        return prevalidate(request, may_block);
+    }
+
+    // Wait for, or fail without, a free slot in the player's submission window
+    grpc::Status throttle_submission(const SubmitScoreRequest& request, bool may_block) {
+        if (!throttle) {
+            return grpc::Status::OK;
+        }
+
+        auto now = SubmissionThrottle::Clock::now();
+        const auto deadline = now + std::chrono::milliseconds(config.request_timeout_ms);
+        SubmissionThrottle::Clock::time_point next_slot;
+        bool delayed = false;
+        while (!throttle->try_acquire(request.leaderboard_id(), request.player_id(), now, &next_slot)) {
+            if (config.player_throttle_mode == ThrottleMode::kReject || !may_block ||
+                next_slot > deadline) {
+                counters.add(kSubmissionsThrottled);
+                return grpc::Status(
+                    grpc::StatusCode::RESOURCE_EXHAUSTED,
+                    "Too many submissions for " + request.player_id() + " on " +
+                    request.leaderboard_id() + " (limit: " +
+                    std::to_string(config.player_submission_limit) + " per " +
+                    std::to_string(config.player_submission_window_ms) + "ms)");
+            }
+            if (!delayed) {
+                counters.add(kSubmissionsDelayed);
+                delayed = true;
+            }
+            VLOG(1) << "Delaying submission for " << request.player_id() << " on "
+                    << request.leaderboard_id() << " until its submission window has room";
+            std::this_thread::sleep_until(next_slot);
+            now = SubmissionThrottle::Clock::now();
+        }
+        return grpc::Status::OK;
+    }
+
+    // Check a submission against its leaderboard's rules. Returns an error
+    // status only if the submission must not be sent. Rules that cannot be
+    // fetched disable the checks until the cache entry expires; the server
+    // still enforces them.
+    grpc::Status prevalidate(const SubmitScoreRequest& request, bool may_block) {
+        // Only the API key changes after construction, so no lock is needed here
+        const LocalValidation mode = config.local_validation;
+        if (mode == LocalValidation::kOff) {
+            return grpc::Status::OK;
+        }
+
+        auto rules = rules_for(request.leaderboard_id(), may_block);
+        if (!rules || !rules->anticheat_enabled()) {
+            return grpc::Status::OK;
+        }
+
+        auto now = ScoreValidator::Clock::now();
+        auto violations = validator.check(request, *rules, now);
+        if (violations.empty()) {
+            validator.record(request, *rules, now);
+            return grpc::Status::OK;
+        }
+
+        std::ostringstream summary;
+        for (size_t i = 0; i < violations.size(); ++i) {
+            summary << (i > 0 ? "; " : "") << violations[i].flag_type() << ": "
+                    << violations[i].reason();
+        }
+
+        if (mode == LocalValidation::kFlag) {
+            LOG(WARNING) << "Submission for " << request.player_id() << " on "
+                         << request.leaderboard_id() << " breaks leaderboard rules ("
+                         << summary.str() << "); sending anyway";
+            counters.add(kSubmissionsFlaggedLocally);
+            validator.record(request, *rules, now);
+            return grpc::Status::OK;
+        }
+
+        LOG(WARNING) << "Rejected submission for " << request.player_id() << " on "
+                     << request.leaderboard_id() << " locally: " << summary.str();
+        counters.add(kSubmissionsRejectedLocally);
+        return grpc::Status(grpc::StatusCode::INVALID_ARGUMENT,
+                            "Rejected by local validation: " + summary.str());
+    }
+
+    // Cached rules of a leaderboard, fetched on a miss. Null if unavailable.
+    // Concurrent misses share one fetch: the first thread fetches, and the
+    // rest wait for it and read the cache. Unless may_block, a miss starts
+    // the fetch in the background and returns null at once.
+    std::shared_ptr<const GetLeaderboardRulesResponse> rules_for(const std::string& leaderboard_id,
+                                                                 bool may_block = true) {
+        std::shared_ptr<const GetLeaderboardRulesResponse> rules;
+        if (validator.cached_rules(leaderboard_id, ScoreValidator::Clock::now(), &rules)) {
+            return rules;
+        }
+        if (!may_block) {
+            prefetch_rules(leaderboard_id);
+            return nullptr;
+        }
+
+        {
+            std::unique_lock<std::mutex> lock(rules_fetch_mutex);
+            if (rules_fetching.count(leaderboard_id) > 0) {
+                rules_fetched.wait(lock, [&]() { return rules_fetching.count(leaderboard_id) == 0; });
+                lock.unlock();
+                validator.cached_rules(leaderboard_id, ScoreValidator::Clock::now(), &rules);
+                return rules;
+            }
+            // A fetch may have finished between the cache miss and the lock
+            if (validator.cached_rules(leaderboard_id, ScoreValidator::Clock::now(), &rules)) {
+                return rules;
+            }
+            rules_fetching.insert(leaderboard_id);
+        }
+
+        GetLeaderboardRulesRequest request;
+        request.set_leaderboard_id(leaderboard_id);
+        fetch_rules(request);
+        {
+            std::lock_guard<std::mutex> lock(rules_fetch_mutex);
+            rules_fetching.erase(leaderboard_id);
+        }
+        rules_fetched.notify_all();
+
+        validator.cached_rules(leaderboard_id, ScoreValidator::Clock::now(), &rules);
+        return rules;
+    }
+
+    // Fetch a leaderboard's rules on a background thread unless a fetch is
+    // already running
+    void prefetch_rules(const std::string& leaderboard_id) {
+        {
+            std::lock_guard<std::mutex> lock(rules_fetch_mutex);
+            if (!rules_fetching.insert(leaderboard_id).second) {
+                return;
+            }
+        }
+        add_pending_operation(std::async(std::launch::async, [this, leaderboard_id]() {
+            pin_callback_thread();
+            GetLeaderboardRulesRequest request;
+            request.set_leaderboard_id(leaderboard_id);
+            fetch_rules(request);
+            {
+                std::lock_guard<std::mutex> lock(rules_fetch_mutex);
+                rules_fetching.erase(leaderboard_id);
+            }
+            rules_fetched.notify_all();
+        }));
+    }
+
+    // Fetch a leaderboard's rules and cache the outcome, including failures
+    Result<GetLeaderboardRulesResponse> fetch_rules(const GetLeaderboardRulesRequest& request) {
+        VLOG(1) << "Fetching rules for leaderboard " << request.leaderboard_id();
+        auto result = make_request<GetLeaderboardRulesRequest, GetLeaderboardRulesResponse>(
+            request,
+            [this](grpc::ClientContext* ctx, const GetLeaderboardRulesRequest& req,
+                   GetLeaderboardRulesResponse* resp) {
+                return get_stub().GetLeaderboardRules(ctx, req, resp);
+            }
+        );
+
+        std::chrono::milliseconds ttl(config.rules_cache_ttl_ms);
+        std::shared_ptr<const GetLeaderboardRulesResponse> rules;
+        if (result.is_ok()) {
+            if (result.value().cache_ttl_seconds() > 0) {
+                ttl = std::chrono::seconds(result.value().cache_ttl_seconds());
+            }
+            // The next period may come with new rules
+            BestScoreCache::Clock::time_point period_end;
+            auto now = BestScoreCache::Clock::now();
+            if (BestScoreCache::period_end(result.value(), &period_end) && period_end > now &&
+                period_end - now < ttl) {
+                ttl = std::chrono::duration_cast<std::chrono::milliseconds>(period_end - now) +
+                      std::chrono::milliseconds(1);
+            }
+            rules = std::make_shared<const GetLeaderboardRulesResponse>(result.value());
+        } else {
+            LOG(WARNING) << "Leaderboard rules for " << request.leaderboard_id()
+                         << " unavailable; skipping local validation for "
+                         << ttl.count() << "ms";
+        }
+        validator.store_rules(request.leaderboard_id(), std::move(rules),
+                              ScoreValidator::Clock::now() + ttl);
+        return result;
+    }
+
+    static void report_status(const StatusCallback& callback, const grpc::Status& status) {
+        if (!callback) {
+            return;
+        }
+        try {
+            callback(static_cast<int>(status.error_code()), status.error_message());
+        } catch (const std::exception& e) {
+            LOG(ERROR) << "Exception in fire-and-forget callback: " << e.what();
+        } catch (...) {
+            LOG(ERROR) << "Unknown exception in fire-and-forget callback";
+        }
     }
 
     // Add a pending operation and clean up completed ones
@@ -153,62 +1170,123 @@ public:
         pending_operations.push_back(std::move(op));
     }
 
+    // Create the channel on first use. Safe to call from multiple threads.
+    void ensure_channel() {
+        std::call_once(channel_once, [this]() { init_channel(); });
+    }
+
+    grpc::Channel& get_channel() {
+        ensure_channel();
+        return *channel;
+    }
+
+    ::ascnd::v1::AscndService::Stub& get_stub() {
+        ensure_channel();
+        return *stub;
+    }
+
     void init_channel() {
-        std::shared_ptr<grpc::ChannelCredentials> creds;
+        channel = CreateChannel(config);
+        init_stubs();
 
-        if (config.use_ssl) {
-            VLOG(1) << "Creating SSL channel to " << config.server_address;
-            creds = grpc::SslCredentials(grpc::SslCredentialsOptions());
-        } else {
-            LOG(WARNING) << "Creating insecure channel to " << config.server_address
-                         << " (SSL disabled)";
-            creds = grpc::InsecureChannelCredentials();
-        }
+        VLOG(1) << "Channel created successfully";
+    }
 
-        // Set channel arguments
-        grpc::ChannelArguments args;
+    void init_stubs() {
+        stub = ::ascnd::v1::AscndService::NewStub(channel);
+        generic_stub = std::make_unique<grpc::GenericStub>(channel);
 
-        if (!config.user_agent.empty()) {
-            args.SetUserAgentPrefix(config.user_agent);
-        } else {
-            args.SetUserAgentPrefix("ascnd-cpp-client/1.0.0");
+        if (!config.session_mode) {
+            return;
         }
+        VLOG(1) << "Session mode enabled";
+        auto created = std::make_unique<Session>(
+            channel,
+            [this]() { return create_stream_context(call_options()); },
+            [this]() { pin_completion_thread(); });
+        std::lock_guard<std::mutex> lock(mutex);
+        session = std::move(created);
+    }
 
-        // Create channel
-        channel = grpc::CreateCustomChannel(config.server_address, creds, args);
-        stub = ::ascnd::v1::AscndService::NewStub(channel);
+    // Per-request settings, copied under the lock so that set_api_key() can
+    // run concurrently with requests
+    struct CallOptions {
+        std::string api_key;
+        int request_timeout_ms = 0;
+        int max_retries = 0;
+        int retry_delay_ms = 0;
+    };
 
-        VLOG(1) << "Channel created successfully";
+    CallOptions call_options() const {
+        std::lock_guard<std::mutex> lock(mutex);
+        return CallOptions{config.api_key, config.request_timeout_ms,
+                           config.max_retries, config.retry_delay_ms};
     }
 
-    std::unique_ptr<grpc::ClientContext> create_context() {
-        auto context = std::make_unique<grpc::ClientContext>();
+    static std::unique_ptr<grpc::ClientContext> create_context(const CallOptions& options) {
+        auto context = create_stream_context(options);
 
         // Set deadline
         auto deadline = std::chrono::system_clock::now() +
-                        std::chrono::milliseconds(config.request_timeout_ms);
+                        std::chrono::milliseconds(options.request_timeout_ms);
         context->set_deadline(deadline);
 
+        return context;
+    }
+
+    // Streams are long-lived, so their contexts carry metadata but no deadline
+    static std::unique_ptr<grpc::ClientContext> create_stream_context(const CallOptions& options) {
+        auto context = std::make_unique<grpc::ClientContext>();
+
         // Add API key as metadata
-        if (!config.api_key.empty()) {
-            context->AddMetadata("authorization", "Bearer " + config.api_key);
+        if (!options.api_key.empty()) {
+            context->AddMetadata("authorization", "Bearer " + options.api_key);
         }
 
         return context;
     }
 
+    // Issue a unary RPC, or carry it over the session stream in session mode.
+    // Falls back to unary calls for good if the server lacks the Session RPC.
+    template<typename RequestT, typename ResponseT>
+    grpc::Status invoke(
+        grpc::ClientContext* context,
+        const RequestT& request,
+        ResponseT* response,
+        grpc::Status (::ascnd::v1::AscndService::Stub::*unary)(
+            grpc::ClientContext*, const RequestT&, ResponseT*)
+    ) {
+        ensure_channel();
+        if (session && session->supported()) {
+            ::ascnd::v1::SessionRequest session_request;
+            SetSessionRequest(&session_request, request);
+            ::ascnd::v1::SessionResponse session_response;
+            grpc::Status status = session->call(
+                std::move(session_request), &session_response, context->deadline());
+            if (status.ok()) {
+                return TakeSessionResponse(&session_response, response);
+            }
+            if (status.error_code() != grpc::StatusCode::UNIMPLEMENTED || session->supported()) {
+                return status;
+            }
+            LOG(WARNING) << "Server does not support sessions; falling back to unary calls";
+        }
+        return (stub.get()->*unary)(context, request, response);
+    }
+
     template<typename RequestT, typename ResponseT, typename RpcFunc>
     Result<ResponseT> make_request(const RequestT& request, RpcFunc rpc_func) {
-        std::lock_guard<std::mutex> lock(mutex);
+        const CallOptions options = call_options();
 
-        VLOG(1) << "Starting request (max retries: " << config.max_retries << ")";
+        VLOG(1) << "Starting request (max retries: " << options.max_retries << ")";
 
         ResponseT response;
         grpc::Status status;
 
         int retries = 0;
-        while (retries <= config.max_retries) {
-            auto context = create_context();
+        while (retries <= options.max_retries) {
+            auto context = create_context(options);
+            counters.add(kRequestsSent);
             status = rpc_func(context.get(), request, &response);
 
             if (status.ok()) {
@@ -224,12 +1302,12 @@ public:
                 break;
             }
 
-            if (retries < config.max_retries) {
-                int delay = config.retry_delay_ms * (1 << retries);
+            if (retries < options.max_retries) {
+                int delay = options.retry_delay_ms * (1 << retries);
                 LOG(WARNING) << "Request failed with retryable error: "
                              << status.error_message()
                              << ", retrying in " << delay << "ms"
-                             << " (attempt " << (retries + 1) << "/" << config.max_retries << ")";
+                             << " (attempt " << (retries + 1) << "/" << options.max_retries << ")";
                 std::this_thread::sleep_for(std::chrono::milliseconds(delay));
             }
             ++retries;
@@ -237,6 +1315,7 @@ public:
 
         LOG(ERROR) << "Request failed after " << retries << " attempts: "
                    << status.error_message();
+        counters.add(kRequestsFailed);
 
         return Result<ResponseT>::error(
             status.error_message(),
@@ -267,6 +1346,9 @@ AscndClient::AscndClient(const std::string& server_address, const std::string& a
     impl_ = std::make_shared<Impl>(std::move(config));
 }
 
+AscndClient::AscndClient(ClientConfig config, std::shared_ptr<grpc::Channel> channel)
+    : impl_(std::make_shared<Impl>(std::move(config), std::move(channel))) {}
+
 AscndClient::~AscndClient() {
     // Must wait for pending operations BEFORE releasing impl_,
     // because async lambdas capture a copy of impl_ shared_ptr.
@@ -281,30 +1363,27 @@ AscndClient::AscndClient(AscndClient&&) noexcept = default;
 AscndClient& AscndClient::operator=(AscndClient&&) noexcept = default;
 
 Result<SubmitScoreResponse> AscndClient::submit_score(const SubmitScoreRequest& request) {
-    return impl_->make_request<SubmitScoreRequest, SubmitScoreResponse>(
-        request,
-        [this](grpc::ClientContext* ctx, const SubmitScoreRequest& req, SubmitScoreResponse* resp) {
-            return impl_->stub->SubmitScore(ctx, req, resp);
-        }
-    );
+    return impl_->submit(request);
 }
 
 Result<GetLeaderboardResponse> AscndClient::get_leaderboard(const GetLeaderboardRequest& request) {
-    return impl_->make_request<GetLeaderboardRequest, GetLeaderboardResponse>(
-        request,
-        [this](grpc::ClientContext* ctx, const GetLeaderboardRequest& req, GetLeaderboardResponse* resp) {
-            return impl_->stub->GetLeaderboard(ctx, req, resp);
-        }
-    );
+    return impl_->get_leaderboard(request);
 }
 
 Result<GetPlayerRankResponse> AscndClient::get_player_rank(const GetPlayerRankRequest& request) {
-    return impl_->make_request<GetPlayerRankRequest, GetPlayerRankResponse>(
-        request,
-        [this](grpc::ClientContext* ctx, const GetPlayerRankRequest& req, GetPlayerRankResponse* resp) {
-            return impl_->stub->GetPlayerRank(ctx, req, resp);
-        }
-    );
+    return impl_->get_player_rank(request);
+}
+
+Result<SubmitScoreBatchResponse> AscndClient::submit_score_batch(
+    const SubmitScoreBatchRequest& request
+) {
+    return impl_->submit_batch(request);
+}
+
+Result<GetLeaderboardRulesResponse> AscndClient::get_leaderboard_rules(
+    const GetLeaderboardRulesRequest& request
+) {
+    return impl_->fetch_rules(request);
 }
 
 Result<SubmitScoreResponse> AscndClient::submit_score(
@@ -344,6 +1423,7 @@ std::future<Result<SubmitScoreResponse>> AscndClient::submit_score_async(
     const SubmitScoreRequest& request
 ) {
     return std::async(std::launch::async, [this, request]() {
+        impl_->pin_callback_thread();
         return submit_score(request);
     });
 }
@@ -352,6 +1432,7 @@ std::future<Result<GetLeaderboardResponse>> AscndClient::get_leaderboard_async(
     const GetLeaderboardRequest& request
 ) {
     return std::async(std::launch::async, [this, request]() {
+        impl_->pin_callback_thread();
         return get_leaderboard(request);
     });
 }
@@ -360,10 +1441,20 @@ std::future<Result<GetPlayerRankResponse>> AscndClient::get_player_rank_async(
     const GetPlayerRankRequest& request
 ) {
     return std::async(std::launch::async, [this, request]() {
+        impl_->pin_callback_thread();
         return get_player_rank(request);
     });
 }
 
+std::future<Result<SubmitScoreBatchResponse>> AscndClient::submit_score_batch_async(
+    const SubmitScoreBatchRequest& request
+) {
+    return std::async(std::launch::async, [this, request]() {
+        impl_->pin_callback_thread();
+        return submit_score_batch(request);
+    });
+}
+
 // Callback-based async methods (tracked for proper lifecycle management)
 void AscndClient::submit_score_async(
     const SubmitScoreRequest& request,
@@ -371,14 +1462,9 @@ void AscndClient::submit_score_async(
 ) {
     auto impl = impl_;  // Copy shared_ptr - ensures Impl outlives lambda
     auto future = std::async(std::launch::async, [impl, request, callback = std::move(callback)]() {
+        impl->pin_callback_thread();
         try {
-            auto result = impl->make_request<SubmitScoreRequest, SubmitScoreResponse>(
-                request,
-                [&impl](grpc::ClientContext* ctx, const SubmitScoreRequest& req, SubmitScoreResponse* resp) {
-                    return impl->stub->SubmitScore(ctx, req, resp);
-                }
-            );
-            callback(std::move(result));
+            callback(impl->submit(request));
         } catch (const std::exception& e) {
             LOG(ERROR) << "Exception in async callback: " << e.what();
         } catch (...) {
@@ -395,14 +1481,9 @@ void AscndClient::get_leaderboard_async(
 ) {
     auto impl = impl_;  // Copy shared_ptr - ensures Impl outlives lambda
     auto future = std::async(std::launch::async, [impl, request, callback = std::move(callback)]() {
+        impl->pin_callback_thread();
         try {
-            auto result = impl->make_request<GetLeaderboardRequest, GetLeaderboardResponse>(
-                request,
-                [&impl](grpc::ClientContext* ctx, const GetLeaderboardRequest& req, GetLeaderboardResponse* resp) {
-                    return impl->stub->GetLeaderboard(ctx, req, resp);
-                }
-            );
-            callback(std::move(result));
+            callback(impl->get_leaderboard(request));
         } catch (const std::exception& e) {
             LOG(ERROR) << "Exception in async callback: " << e.what();
         } catch (...) {
@@ -418,14 +1499,27 @@ void AscndClient::get_player_rank_async(
 ) {
     auto impl = impl_;  // Copy shared_ptr - ensures Impl outlives lambda
     auto future = std::async(std::launch::async, [impl, request, callback = std::move(callback)]() {
+        impl->pin_callback_thread();
         try {
-            auto result = impl->make_request<GetPlayerRankRequest, GetPlayerRankResponse>(
-                request,
-                [&impl](grpc::ClientContext* ctx, const GetPlayerRankRequest& req, GetPlayerRankResponse* resp) {
-                    return impl->stub->GetPlayerRank(ctx, req, resp);
-                }
-            );
-            callback(std::move(result));
+            callback(impl->get_player_rank(request));
+        } catch (const std::exception& e) {
+            LOG(ERROR) << "Exception in async callback: " << e.what();
+        } catch (...) {
+            LOG(ERROR) << "Unknown exception in async callback";
+        }
+    });
+    impl_->add_pending_operation(std::move(future));
+}
+
+void AscndClient::submit_score_batch_async(
+    const SubmitScoreBatchRequest& request,
+    AsyncCallback<SubmitScoreBatchResponse> callback
+) {
+    auto impl = impl_;  // Copy shared_ptr - ensures Impl outlives lambda
+    auto future = std::async(std::launch::async, [impl, request, callback = std::move(callback)]() {
+        impl->pin_callback_thread();
+        try {
+            callback(impl->submit_batch(request));
         } catch (const std::exception& e) {
             LOG(ERROR) << "Exception in async callback: " << e.what();
         } catch (...) {
@@ -435,9 +1529,109 @@ void AscndClient::get_player_rank_async(
     impl_->add_pending_operation(std::move(future));
 }
 
+// Flat value methods: converted at the boundary, otherwise identical
+namespace {
+
+template<typename Response>
+auto ToFlatResult(Result<Response> result) -> Result<decltype(ToFlat(std::declval<Response>()))> {
+    using Flat = decltype(ToFlat(std::declval<Response>()));
+    if (result.is_error()) {
+        return Result<Flat>::error(result.error(), result.error_code());
+    }
+    return Result<Flat>::ok(ToFlat(std::move(result).value()));
+}
+
+}  // anonymous namespace
+
+Result<flat::SubmitResult> AscndClient::submit_score(const flat::ScoreSubmission& submission) {
+    return ToFlatResult(submit_score(ToProto(submission)));
+}
+
+Result<flat::Leaderboard> AscndClient::get_leaderboard(const flat::LeaderboardQuery& query) {
+    return ToFlatResult(get_leaderboard(ToProto(query)));
+}
+
+Result<flat::PlayerRank> AscndClient::get_player_rank(const flat::PlayerRankQuery& query) {
+    return ToFlatResult(get_player_rank(ToProto(query)));
+}
+
+void AscndClient::submit_score_async(
+    const flat::ScoreSubmission& submission,
+    AsyncCallback<flat::SubmitResult> callback
+) {
+    submit_score_async(ToProto(submission), [callback = std::move(callback)](Result<SubmitScoreResponse> result) {
+        callback(ToFlatResult(std::move(result)));
+    });
+}
+
+void AscndClient::get_leaderboard_async(
+    const flat::LeaderboardQuery& query,
+    AsyncCallback<flat::Leaderboard> callback
+) {
+    get_leaderboard_async(ToProto(query), [callback = std::move(callback)](Result<GetLeaderboardResponse> result) {
+        callback(ToFlatResult(std::move(result)));
+    });
+}
+
+void AscndClient::get_player_rank_async(
+    const flat::PlayerRankQuery& query,
+    AsyncCallback<flat::PlayerRank> callback
+) {
+    get_player_rank_async(ToProto(query), [callback = std::move(callback)](Result<GetPlayerRankResponse> result) {
+        callback(ToFlatResult(std::move(result)));
+    });
+}
+
+std::unique_ptr<ScoreStream> AscndClient::open_score_stream(
+    ScoreAckCallback callback,
+    ScoreStreamOptions options
+) {
+    if (!callback) {
+        throw std::invalid_argument("open_score_stream requires a callback");
+    }
+    if (options.max_in_flight <= 0) {
+        throw std::invalid_argument("max_in_flight must be positive");
+    }
+
+    auto context = Impl::create_stream_context(impl_->call_options());
+    impl_->ensure_channel();
+
+    VLOG(1) << "Opening score stream (max in flight: " << options.max_in_flight << ")";
+    return ScoreStream::open(impl_->channel, std::move(context), std::move(callback), options);
+}
+
+std::unique_ptr<RankWatcher> AscndClient::watch_player_ranks(RankChangeCallback callback) {
+    if (!callback) {
+        throw std::invalid_argument("watch_player_ranks requires a callback");
+    }
+
+    auto context = Impl::create_stream_context(impl_->call_options());
+    impl_->ensure_channel();
+
+    VLOG(1) << "Opening rank watcher";
+    return RankWatcher::open(impl_->channel, std::move(context), std::move(callback));
+}
+
+void AscndClient::submit_score_fire_and_forget(
+    const SubmitScoreRequest& request,
+    StatusCallback callback
+) {
+    impl_->submit_fire_and_forget(request, std::move(callback));
+}
+
 void AscndClient::set_api_key(const std::string& api_key) {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
-    impl_->config.api_key = api_key;
+    Session* session = nullptr;
+    {
+        // The session is read under the same lock, so if it is not there
+        // yet, its first stream will carry the new key
+        std::lock_guard<std::mutex> lock(impl_->mutex);
+        impl_->config.api_key = api_key;
+        session = impl_->session.get();
+    }
+    // The session stream carries the old key in its metadata
+    if (session) {
+        session->reset();
+    }
 }
 
 ClientConfig AscndClient::config() const {
@@ -445,16 +1639,49 @@ ClientConfig AscndClient::config() const {
     return impl_->config;
 }
 
-bool AscndClient::ping() {
-    std::lock_guard<std::mutex> lock(impl_->mutex);
+std::optional<ViewInfo> AscndClient::cached_view(
+    const std::string& leaderboard_id,
+    const std::string& view_slug
+) const {
+    std::lock_guard<std::mutex> lock(impl_->views_mutex);
+    auto it = impl_->views.find(std::make_pair(leaderboard_id, view_slug));
+    if (it == impl_->views.end()) {
+        return std::nullopt;
+    }
+    return it->second;
+}
 
+ClientStats AscndClient::stats() const {
+    ClientStats stats;
+    const auto& counters = impl_->counters;
+    stats.submissions_rejected_locally = counters.sum(Impl::kSubmissionsRejectedLocally);
+    stats.submissions_flagged_locally = counters.sum(Impl::kSubmissionsFlaggedLocally);
+    stats.submissions_delayed = counters.sum(Impl::kSubmissionsDelayed);
+    stats.submissions_throttled = counters.sum(Impl::kSubmissionsThrottled);
+    stats.submissions_skipped = counters.sum(Impl::kSubmissionsSkipped);
+    stats.submissions_batched = counters.sum(Impl::kSubmissionsBatched);
+    stats.submissions_lost = counters.sum(Impl::kSubmissionsLost);
+    stats.player_rank_cache_hits = counters.sum(Impl::kPlayerRankCacheHits);
+    stats.player_rank_batches = counters.sum(Impl::kPlayerRankBatches);
+    stats.player_ranks_batched = counters.sum(Impl::kPlayerRanksBatched);
+    stats.requests_sent = counters.sum(Impl::kRequestsSent);
+    stats.requests_failed = counters.sum(Impl::kRequestsFailed);
+    stats.rank_batch_windows = impl_->histogram(Impl::kRankBatchWindows);
+    stats.rank_batch_sizes = impl_->histogram(Impl::kRankBatchSizes);
+    stats.submit_batch_windows = impl_->histogram(Impl::kSubmitBatchWindows);
+    stats.submit_batch_sizes = impl_->histogram(Impl::kSubmitBatchSizes);
+    return stats;
+}
+
+bool AscndClient::ping() {
+    // Only the API key changes after construction, so no lock is needed here
     VLOG(1) << "Testing connection to " << impl_->config.server_address;
 
     // Wait for channel to be ready with timeout
     auto deadline = std::chrono::system_clock::now() +
                     std::chrono::milliseconds(impl_->config.connection_timeout_ms);
 
-    bool connected = impl_->channel->WaitForConnected(deadline);
+    bool connected = impl_->get_channel().WaitForConnected(deadline);
 
     if (connected) {
         VLOG(1) << "Connection successful";
@@ -0,0 +1,180 @@
+/**
+ * @file flat_convert.cpp
+ * @brief Implementation of the flat value conversions
+ */
+
+#include "flat_convert.hpp"
+
+#include <utility>
+
+namespace ascnd {
+
+namespace {
+
+flat::Bracket ToFlat(BracketInfo* bracket) {
+    flat::Bracket result;
+    result.id = bracket->id();
+    result.name = std::move(*bracket->mutable_name());
+    if (bracket->has_color()) {
+        result.color = std::move(*bracket->mutable_color());
+    }
+    return result;
+}
+
+flat::View ToFlat(ViewInfo* view) {
+    return flat::View{std::move(*view->mutable_slug()), std::move(*view->mutable_name())};
+}
+
+// Index of an inline bracket in the page's bracket list, appending it if new
+int32_t InternBracket(BracketInfo* bracket, std::vector<flat::Bracket>* brackets) {
+    for (size_t i = 0; i < brackets->size(); ++i) {
+        if ((*brackets)[i].id.view() == bracket->id()) {
+            return static_cast<int32_t>(i);
+        }
+    }
+    brackets->push_back(ToFlat(bracket));
+    return static_cast<int32_t>(brackets->size() - 1);
+}
+
+}  // anonymous namespace
+
+SubmitScoreRequest ToProto(const flat::ScoreSubmission& submission) {
+    SubmitScoreRequest request;
+    request.set_leaderboard_id(submission.leaderboard_id.data(), submission.leaderboard_id.size());
+    request.set_player_id(submission.player_id.data(), submission.player_id.size());
+    request.set_score(submission.score);
+    if (submission.metadata) {
+        request.set_metadata(*submission.metadata);
+    }
+    if (submission.idempotency_key) {
+        request.set_idempotency_key(*submission.idempotency_key);
+    }
+    return request;
+}
+
+GetLeaderboardRequest ToProto(const flat::LeaderboardQuery& query) {
+    GetLeaderboardRequest request;
+    request.set_leaderboard_id(query.leaderboard_id.data(), query.leaderboard_id.size());
+    if (query.limit) {
+        request.set_limit(*query.limit);
+    }
+    if (query.offset) {
+        request.set_offset(*query.offset);
+    }
+    if (query.period) {
+        request.set_period(*query.period);
+    }
+    if (query.view_slug) {
+        request.set_view_slug(*query.view_slug);
+    }
+    // Matches flat::Leaderboard's layout and keeps repeated brackets off the wire
+    request.set_bracket_dictionary(true);
+    return request;
+}
+
+GetPlayerRankRequest ToProto(const flat::PlayerRankQuery& query) {
+    GetPlayerRankRequest request;
+    request.set_leaderboard_id(query.leaderboard_id.data(), query.leaderboard_id.size());
+    request.set_player_id(query.player_id.data(), query.player_id.size());
+    if (query.period) {
+        request.set_period(*query.period);
+    }
+    if (query.view_slug) {
+        request.set_view_slug(*query.view_slug);
+    }
+    return request;
+}
+
+flat::SubmitResult ToFlat(SubmitScoreResponse&& response) {
+    flat::SubmitResult result;
+    result.score_id = std::move(*response.mutable_score_id());
+    result.rank = response.rank();
+    result.is_new_best = response.is_new_best();
+    result.was_deduplicated = response.was_deduplicated();
+    if (response.has_anticheat()) {
+        AnticheatResult* anticheat = response.mutable_anticheat();
+        flat::Anticheat& flat_anticheat = result.anticheat.emplace();
+        flat_anticheat.passed = anticheat->passed();
+        flat_anticheat.action = std::move(*anticheat->mutable_action());
+        flat_anticheat.violations.reserve(static_cast<size_t>(anticheat->violations_size()));
+        for (AnticheatViolation& violation : *anticheat->mutable_violations()) {
+            flat_anticheat.violations.push_back(flat::AnticheatViolation{
+                std::move(*violation.mutable_flag_type()), std::move(*violation.mutable_reason())});
+        }
+    }
+    return result;
+}
+
+flat::Leaderboard ToFlat(GetLeaderboardResponse&& response) {
+    flat::Leaderboard result;
+    result.brackets.reserve(static_cast<size_t>(response.brackets_size()));
+    for (BracketInfo& bracket : *response.mutable_brackets()) {
+        result.brackets.push_back(ToFlat(&bracket));
+    }
+    const size_t dictionary_size = result.brackets.size();
+
+    result.entries.resize(static_cast<size_t>(response.entries_size()));
+    for (int i = 0; i < response.entries_size(); ++i) {
+        LeaderboardEntry* entry = response.mutable_entries(i);
+        flat::LeaderboardEntry& flat_entry = result.entries[static_cast<size_t>(i)];
+        flat_entry.score = entry->score();
+        flat_entry.rank = entry->rank();
+        flat_entry.player_id = entry->player_id();
+        flat_entry.submitted_at = std::move(*entry->mutable_submitted_at());
+        if (entry->has_metadata()) {
+            flat_entry.metadata = std::move(*entry->mutable_metadata());
+        }
+        if (entry->has_bracket()) {
+            flat_entry.bracket = InternBracket(entry->mutable_bracket(), &result.brackets);
+        } else if (entry->has_bracket_index() && entry->bracket_index() >= 0 &&
+                   static_cast<size_t>(entry->bracket_index()) < dictionary_size) {
+            flat_entry.bracket = entry->bracket_index();
+        }
+    }
+
+    result.total_entries = response.total_entries();
+    result.has_more = response.has_more();
+    result.period_start = std::move(*response.mutable_period_start());
+    if (response.has_period_end()) {
+        result.period_end = std::move(*response.mutable_period_end());
+    }
+    if (response.has_view()) {
+        result.view = ToFlat(response.mutable_view());
+    }
+    return result;
+}
+
+flat::PlayerRank ToFlat(GetPlayerRankResponse&& response) {
+    flat::PlayerRank result;
+    if (response.has_rank()) {
+        result.rank = response.rank();
+    }
+    if (response.has_score()) {
+        result.score = response.score();
+    }
+    if (response.has_best_score()) {
+        result.best_score = response.best_score();
+    }
+    result.total_entries = response.total_entries();
+    if (response.has_percentile()) {
+        result.percentile = std::move(*response.mutable_percentile());
+    }
+    if (response.has_bracket()) {
+        result.bracket = ToFlat(response.mutable_bracket());
+    }
+    if (response.has_view()) {
+        result.view = ToFlat(response.mutable_view());
+    }
+    if (response.has_global_rank()) {
+        result.global_rank = response.global_rank();
+    }
+    if (response.has_global_total_entries()) {
+        result.global_total_entries = response.global_total_entries();
+    }
+    if (response.has_global_percentile()) {
+        result.global_percentile = std::move(*response.mutable_global_percentile());
+    }
+    return result;
+}
+
+} // namespace ascnd
@@ -0,0 +1,24 @@
+#pragma once
+
+/**
+ * @file flat_convert.hpp
+ * @brief Conversion between flat value types and protobuf messages
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/flat.hpp"
+#include "ascnd/types.hpp"
+
+namespace ascnd {
+
+SubmitScoreRequest ToProto(const flat::ScoreSubmission& submission);
+GetLeaderboardRequest ToProto(const flat::LeaderboardQuery& query);
+GetPlayerRankRequest ToProto(const flat::PlayerRankQuery& query);
+
+// Strings are moved out of the response rather than copied
+flat::SubmitResult ToFlat(SubmitScoreResponse&& response);
+flat::Leaderboard ToFlat(GetLeaderboardResponse&& response);
+flat::PlayerRank ToFlat(GetPlayerRankResponse&& response);
+
+} // namespace ascnd
@@ -0,0 +1,76 @@
+#pragma once
+
+/**
+ * @file lru_map.hpp
+ * @brief Size-bounded map evicting the least recently used entry
+ *
+ * Internal to the library; not installed.
+ */
+
+#include <cstddef>
+#include <list>
+#include <unordered_map>
+#include <utility>
+
+namespace ascnd {
+
+/**
+ * @brief Map holding at most a fixed number of entries
+ *
+ * Lookups and inserts mark an entry as most recently used; inserting into a
+ * full map evicts the least recently used one. Not thread-safe.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>>
+class LruMap {
+public:
+    explicit LruMap(size_t capacity) : capacity_(capacity) {}
+
+    /// Returns the value for key, or nullptr if absent
+    Value* find(const Key& key) {
+        auto it = index_.find(key);
+        if (it == index_.end()) {
+            return nullptr;
+        }
+        entries_.splice(entries_.begin(), entries_, it->second);
+        return &it->second->second;
+    }
+
+    /// Inserts or replaces the value for key and returns it
+    Value& put(const Key& key, Value value) {
+        if (Value* existing = find(key)) {
+            *existing = std::move(value);
+            return *existing;
+        }
+        if (capacity_ > 0 && entries_.size() >= capacity_) {
+            index_.erase(entries_.back().first);
+            entries_.pop_back();
+        }
+        entries_.emplace_front(key, std::move(value));
+        index_.emplace(key, entries_.begin());
+        return entries_.front().second;
+    }
+
+    void erase(const Key& key) {
+        auto it = index_.find(key);
+        if (it != index_.end()) {
+            entries_.erase(it->second);
+            index_.erase(it);
+        }
+    }
+
+    void clear() {
+        index_.clear();
+        entries_.clear();
+    }
+
+    [[nodiscard]] size_t size() const { return entries_.size(); }
+
+private:
+    using Entries = std::list<std::pair<Key, Value>>;
+
+    size_t capacity_;
+    Entries entries_;
+    std::unordered_map<Key, typename Entries::iterator, Hash> index_;
+};
+
+} // namespace ascnd
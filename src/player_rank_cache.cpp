@@ -0,0 +1,115 @@
+/**
+ * @file player_rank_cache.cpp
+ * @brief Implementation of the player rank response cache
+ */
+
+#include "player_rank_cache.hpp"
+
+namespace ascnd {
+
+PlayerRankCache::PlayerRankCache(Clock::duration ttl)
+    : ttl_(ttl), players_(kMaxTrackedPlayers) {}
+
+bool PlayerRankCache::lookup(const GetPlayerRankRequest& request, Clock::time_point now,
+                             GetPlayerRankResponse* response) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PlayerResponses* player = players_.find(player_key(request.leaderboard_id(), request.player_id()));
+    if (!player) {
+        return false;
+    }
+    auto* responses = &player->responses;
+
+    const std::string period = period_of(request);
+    auto fresh = [&](const Cached& cached) { return now - cached.stored < ttl_; };
+
+    auto exact = responses->find(std::make_pair(period, request.view_slug()));
+    if (exact != responses->end() && fresh(exact->second)) {
+        *response = exact->second.response;
+        return true;
+    }
+    if (request.has_view_slug()) {
+        return false;
+    }
+
+    // Any view of the same period knows the player's global position
+    for (auto it = responses->lower_bound(std::make_pair(period, std::string()));
+         it != responses->end() && it->first.first == period; ++it) {
+        if (fresh(it->second) && without_view(it->second.response, response)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t PlayerRankCache::generation(const std::string& leaderboard_id, const std::string& player_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return player_locked(player_key(leaderboard_id, player_id)).generation;
+}
+
+void PlayerRankCache::store(const GetPlayerRankRequest& request, const GetPlayerRankResponse& response,
+                            Clock::time_point now, uint64_t generation) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    PlayerResponses& player = player_locked(player_key(request.leaderboard_id(), request.player_id()));
+    if (generation < player.generation) {
+        return;  // Fetched before the player's last submission
+    }
+    player.responses[std::make_pair(period_of(request), request.view_slug())] = Cached{response, now};
+}
+
+void PlayerRankCache::invalidate(const std::string& leaderboard_id, const std::string& player_id) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++latest_generation_;
+    if (PlayerResponses* player = players_.find(player_key(leaderboard_id, player_id))) {
+        player->responses.clear();
+        player->generation = latest_generation_;
+    }
+}
+
+PlayerRankCache::PlayerResponses& PlayerRankCache::player_locked(const std::string& key) {
+    if (PlayerResponses* player = players_.find(key)) {
+        return *player;
+    }
+    PlayerResponses player;
+    player.generation = latest_generation_;
+    return players_.put(key, std::move(player));
+}
+
+std::string PlayerRankCache::player_key(const std::string& leaderboard_id, const std::string& player_id) {
+    std::string key = leaderboard_id;
+    key.push_back('\0');
+    key += player_id;
+    return key;
+}
+
+std::string PlayerRankCache::period_of(const GetPlayerRankRequest& request) {
+    // An unset period means the current one
+    return request.has_period() ? request.period() : "current";
+}
+
+bool PlayerRankCache::without_view(const GetPlayerRankResponse& view_response,
+                                   GetPlayerRankResponse* response) {
+    if (!view_response.has_global_total_entries()) {
+        return false;  // Server predates global totals on view responses
+    }
+
+    response->Clear();
+    if (view_response.has_global_rank()) {
+        response->set_rank(view_response.global_rank());
+    }
+    if (view_response.has_score()) {
+        response->set_score(view_response.score());
+    }
+    if (view_response.has_best_score()) {
+        response->set_best_score(view_response.best_score());
+    }
+    response->set_total_entries(view_response.global_total_entries());
+    if (view_response.has_global_percentile()) {
+        response->set_percentile(view_response.global_percentile());
+    }
+    if (view_response.has_bracket()) {
+        *response->mutable_bracket() = view_response.bracket();
+    }
+    return true;
+}
+
+} // namespace ascnd
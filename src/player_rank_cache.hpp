@@ -0,0 +1,101 @@
+#pragma once
+
+/**
+ * @file player_rank_cache.hpp
+ * @brief Short-lived reuse of GetPlayerRank responses across views
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/types.hpp"
+#include "lru_map.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+
+namespace ascnd {
+
+/**
+ * @brief Answers GetPlayerRank requests from recent responses
+ *
+ * Besides identical requests, a request without a view is answered from a
+ * recent response for any view of the same player and period, because view
+ * responses carry the player's global rank, total and percentile. Responses
+ * of a player are dropped when they submit a score, and responses fetched
+ * before that are not stored afterwards. Bounded to the most recently
+ * queried players. Thread-safe.
+ */
+class PlayerRankCache {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Players whose responses are kept
+    static constexpr size_t kMaxTrackedPlayers = 10000;
+
+    /// @param ttl How long a response may be reused
+    explicit PlayerRankCache(Clock::duration ttl);
+
+    /**
+     * @brief Find a response answering a request
+     * @return false if no fresh response answers it
+     */
+    bool lookup(const GetPlayerRankRequest& request, Clock::time_point now,
+                GetPlayerRankResponse* response);
+
+    /**
+     * @brief Generation of a player's responses, taken before fetching one
+     *
+     * invalidate() moves the player to a newer generation, so a response
+     * fetched under an older one is not stored.
+     */
+    uint64_t generation(const std::string& leaderboard_id, const std::string& player_id);
+
+    /**
+     * @brief Keep a response for reuse
+     * @param generation generation() of the player when the fetch started
+     */
+    void store(const GetPlayerRankRequest& request, const GetPlayerRankResponse& response,
+               Clock::time_point now, uint64_t generation);
+
+    /**
+     * @brief Drop every response of a player on a leaderboard
+     */
+    void invalidate(const std::string& leaderboard_id, const std::string& player_id);
+
+private:
+    struct Cached {
+        GetPlayerRankResponse response;
+        Clock::time_point stored;
+    };
+
+    // Responses of one player and leaderboard, by period and view slug
+    struct PlayerResponses {
+        std::map<std::pair<std::string, std::string>, Cached> responses;
+        uint64_t generation = 0;
+    };
+
+    // Find a player's entry, creating it in the latest generation
+    PlayerResponses& player_locked(const std::string& key);
+
+    static std::string player_key(const std::string& leaderboard_id, const std::string& player_id);
+    static std::string period_of(const GetPlayerRankRequest& request);
+
+    // Derive the response to a request without a view from a view response
+    static bool without_view(const GetPlayerRankResponse& view_response,
+                             GetPlayerRankResponse* response);
+
+    const Clock::duration ttl_;
+
+    std::mutex mutex_;
+    LruMap<std::string, PlayerResponses> players_;
+    // Bumped by every invalidate(); new entries start here, so an entry
+    // evicted and recreated during a fetch still rejects its response
+    uint64_t latest_generation_ = 0;
+};
+
+} // namespace ascnd
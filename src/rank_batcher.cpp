@@ -0,0 +1,144 @@
+/**
+ * @file rank_batcher.cpp
+ * @brief Implementation of GetPlayerRank coalescing
+ */
+
+#include "rank_batcher.hpp"
+
+#include <grpcpp/support/status.h>
+#include <glog/logging.h>
+
+#include <utility>
+
+namespace ascnd {
+
+RankBatcher::RankBatcher(Clock::duration window, bool adaptive, SingleSender single, BatchSender batch,
+                         BatchObserver observer)
+    : window_(window, adaptive),
+      single_(std::move(single)),
+      batch_(std::move(batch)),
+      observer_(std::move(observer)) {}
+
+Result<GetPlayerRankResponse> RankBatcher::get(const GetPlayerRankRequest& request) {
+    if (!supported_) {
+        return single_(request);
+    }
+
+    const std::string key = group_key(request);
+    std::unique_lock<std::mutex> lock(mutex_);
+    window_.arrived(Clock::now());
+    std::shared_ptr<Group>& open = open_[key];
+    if (!open) {
+        open = std::make_shared<Group>();
+    }
+    std::shared_ptr<Group> group = open;
+    group->requests.push_back(request);
+    group->replies.emplace_back();
+    std::future<Reply> reply = group->replies.back().get_future();
+    const bool leader = group->requests.size() == 1;
+
+    if (group->requests.size() >= kMaxBatch) {
+        group->closed = true;
+        open_.erase(key);
+        closed_cv_.notify_all();
+    }
+
+    if (leader) {
+        group->window = window_.next();
+        closed_cv_.wait_for(lock, group->window, [&group]() { return group->closed; });
+        if (!group->closed) {
+            group->closed = true;
+            open_.erase(key);
+        }
+        lock.unlock();
+        send(*group);
+    } else {
+        lock.unlock();
+    }
+
+    Reply result = reply.get();
+    if (!result) {
+        return single_(request);
+    }
+    return std::move(*result);
+}
+
+void RankBatcher::send(Group& group) {
+    if (observer_) {
+        observer_(group.window, group.requests.size());
+    }
+    if (group.requests.size() == 1) {
+        auto start = Clock::now();
+        auto result = single_(group.requests[0]);
+        window_.completed(Clock::now() - start);
+        group.replies[0].set_value(std::move(result));
+        return;
+    }
+
+    const GetPlayerRankRequest& first = group.requests[0];
+    GetPlayerRanksRequest batch;
+    batch.set_leaderboard_id(first.leaderboard_id());
+    if (first.has_period()) {
+        batch.set_period(first.period());
+    }
+    if (first.has_view_slug()) {
+        batch.set_view_slug(first.view_slug());
+    }
+    for (const auto& request : group.requests) {
+        batch.add_player_ids(request.player_id());
+    }
+
+    VLOG(1) << "Sending " << batch.player_ids_size() << " rank lookups on "
+            << batch.leaderboard_id() << " as one batch";
+    auto start = Clock::now();
+    auto result = batch_(batch);
+    window_.completed(Clock::now() - start);
+
+    if (result.is_error()) {
+        if (result.error_code() == static_cast<int>(grpc::StatusCode::UNIMPLEMENTED)) {
+            if (supported_.exchange(false)) {
+                LOG(WARNING) << "Server does not support GetPlayerRanks; sending rank lookups one by one";
+            }
+            for (auto& reply : group.replies) {
+                reply.set_value(std::nullopt);
+            }
+            return;
+        }
+        for (auto& reply : group.replies) {
+            reply.set_value(Result<GetPlayerRankResponse>::error(result.error(), result.error_code()));
+        }
+        return;
+    }
+
+    auto* results = result.value().mutable_results();
+    for (int i = 0; i < static_cast<int>(group.replies.size()); ++i) {
+        std::promise<Reply>& reply = group.replies[static_cast<size_t>(i)];
+        if (i >= results->size()) {
+            reply.set_value(Result<GetPlayerRankResponse>::error(
+                "GetPlayerRanks returned too few results", static_cast<int>(grpc::StatusCode::INTERNAL)));
+            continue;
+        }
+        PlayerRankResult* lookup = results->Mutable(i);
+        if (lookup->error_code() != 0 || !lookup->has_response()) {
+            int code = lookup->error_code() != 0 ? lookup->error_code()
+                                                 : static_cast<int>(grpc::StatusCode::INTERNAL);
+            reply.set_value(Result<GetPlayerRankResponse>::error(lookup->error_message(), code));
+            continue;
+        }
+        GetPlayerRankResponse response;
+        response.Swap(lookup->mutable_response());
+        reply.set_value(Result<GetPlayerRankResponse>::ok(std::move(response)));
+    }
+}
+
+std::string RankBatcher::group_key(const GetPlayerRankRequest& request) {
+    // Unset and empty period or view differ, so presence is part of the key
+    std::string key = request.leaderboard_id();
+    key.push_back('\0');
+    key += request.has_period() ? "+" + request.period() : "-";
+    key.push_back('\0');
+    key += request.has_view_slug() ? "+" + request.view_slug() : "-";
+    return key;
+}
+
+} // namespace ascnd
@@ -0,0 +1,100 @@
+#pragma once
+
+/**
+ * @file rank_batcher.hpp
+ * @brief Coalescing of concurrent GetPlayerRank calls into GetPlayerRanks
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/types.hpp"
+#include "batch_window.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace ascnd {
+
+/**
+ * @brief Collects rank lookups for the same leaderboard, period and view
+ *
+ * The first lookup of a group waits up to the batching window for others to
+ * join (see BatchWindow), then sends the whole group as one GetPlayerRanks call on its own
+ * thread and hands every caller its result; no background thread is
+ * involved. A group that reaches kMaxBatch is sent at once, and a group of
+ * one is sent as a plain GetPlayerRank call. If the server does not
+ * implement GetPlayerRanks, every lookup is sent on its own from then on.
+ * Thread-safe.
+ */
+class RankBatcher {
+public:
+    using Clock = std::chrono::steady_clock;
+    using SingleSender = std::function<Result<GetPlayerRankResponse>(const GetPlayerRankRequest&)>;
+    using BatchSender = std::function<Result<GetPlayerRanksResponse>(const GetPlayerRanksRequest&)>;
+    /// Told the window chosen and the lookups sent for every call made
+    using BatchObserver = std::function<void(Clock::duration window, size_t size)>;
+
+    /// Most players in one GetPlayerRanks call
+    static constexpr size_t kMaxBatch = 100;
+
+    /**
+     * @param window How long the first lookup of a group waits for others
+     * @param adaptive Treat window as an upper bound (see BatchWindow)
+     * @param single Sends one lookup as GetPlayerRank
+     * @param batch Sends a group as GetPlayerRanks
+     * @param observer Records each call made; may be empty
+     */
+    RankBatcher(Clock::duration window, bool adaptive, SingleSender single, BatchSender batch,
+                BatchObserver observer = nullptr);
+
+    RankBatcher(const RankBatcher&) = delete;
+    RankBatcher& operator=(const RankBatcher&) = delete;
+
+    /**
+     * @brief Look up a rank, possibly as part of a batch
+     *
+     * Blocks for up to the batching window plus the call itself.
+     */
+    Result<GetPlayerRankResponse> get(const GetPlayerRankRequest& request);
+
+    /// False once the server has rejected GetPlayerRanks as unimplemented
+    [[nodiscard]] bool supported() const { return supported_.load(); }
+
+private:
+    // An empty reply asks the caller to send its lookup on its own
+    using Reply = std::optional<Result<GetPlayerRankResponse>>;
+
+    struct Group {
+        std::vector<GetPlayerRankRequest> requests;
+        std::vector<std::promise<Reply>> replies;
+        bool closed = false;  // No longer accepting lookups
+        Clock::duration window{};
+    };
+
+    static std::string group_key(const GetPlayerRankRequest& request);
+
+    void send(Group& group);
+
+    BatchWindow window_;
+    SingleSender single_;
+    BatchSender batch_;
+    BatchObserver observer_;
+
+    std::mutex mutex_;
+    std::condition_variable closed_cv_;
+    std::unordered_map<std::string, std::shared_ptr<Group>> open_;
+
+    std::atomic<bool> supported_{true};
+};
+
+} // namespace ascnd
@@ -0,0 +1,190 @@
+/**
+ * @file rank_watcher.cpp
+ * @brief Implementation of the WatchPlayerRanks client
+ */
+
+#include "ascnd/rank_watcher.hpp"
+#include "ascnd.grpc.pb.h"
+#include "bidi_stream.hpp"
+
+#include <glog/logging.h>
+
+#include <mutex>
+#include <set>
+#include <utility>
+
+namespace ascnd {
+
+// ============================================================================
+// Stream Reactor
+// ============================================================================
+
+namespace {
+
+// Watcher whose callback runs on this thread, so that unwatch() from inside
+// the callback does not wait for itself
+thread_local const void* t_delivering_watcher = nullptr;
+
+}  // anonymous namespace
+
+// The watched set is mirrored locally so that duplicate requests are never
+// sent and events racing with unwatch() are dropped. delivery_mutex_ is held
+// across the watched check and the callback, and by unwatch(), so that no
+// callback for a player is running or starts once unwatch() returns.
+class RankWatcher::Impl : public BidiStream<WatchPlayerRanksRequest, RankChangeEvent> {
+public:
+    Impl(std::shared_ptr<grpc::Channel> channel,
+         std::unique_ptr<grpc::ClientContext> context,
+         RankChangeCallback callback)
+        : BidiStream(std::move(context)),
+          channel_(std::move(channel)),
+          stub_(::ascnd::v1::AscndService::NewStub(channel_)),
+          callback_(std::move(callback)) {}
+
+    void start() {
+        BidiStream::start([this](grpc::ClientContext* context, auto* reactor) {
+            stub_->async()->WatchPlayerRanks(context, reactor);
+        });
+    }
+
+    bool update(const std::string& leaderboard_id,
+                const std::vector<std::string>& player_ids,
+                bool add) {
+        // Removals wait for a callback in progress; additions need not
+        std::unique_lock<std::mutex> delivery_lock(delivery_mutex_, std::defer_lock);
+        if (!add && t_delivering_watcher != this) {
+            delivery_lock.lock();
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!accepts_writes_locked()) {
+            return false;
+        }
+
+        WatchPlayerRanksRequest request;
+        request.set_leaderboard_id(leaderboard_id);
+        for (const auto& player_id : player_ids) {
+            auto key = std::make_pair(leaderboard_id, player_id);
+            if (add && watched_.insert(key).second) {
+                request.add_add_player_ids(player_id);
+            } else if (!add && watched_.erase(key) > 0) {
+                request.add_remove_player_ids(player_id);
+            }
+        }
+        if (request.add_player_ids_size() == 0 && request.remove_player_ids_size() == 0) {
+            return true;
+        }
+
+        VLOG(1) << (add ? "Watching " : "Unwatching ")
+                << (add ? request.add_player_ids_size() : request.remove_player_ids_size())
+                << " players on " << leaderboard_id;
+        write_locked(lock, std::move(request));
+        return true;
+    }
+
+    Result<uint64_t> close() {
+        close_writes();
+        grpc::Status status = wait_done();
+        if (!status.ok()) {
+            return Result<uint64_t>::error(status.error_message(),
+                                           static_cast<int>(status.error_code()));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return Result<uint64_t>::ok(delivered_);
+    }
+
+    void shutdown() {
+        cancel();
+        wait_done();
+    }
+
+    size_t watched_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return watched_.size();
+    }
+
+protected:
+    void on_read(RankChangeEvent& event) override {
+        std::lock_guard<std::mutex> delivery_lock(delivery_mutex_);
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (watched_.count(std::make_pair(event.leaderboard_id(), event.player_id())) == 0) {
+                return;
+            }
+            ++delivered_;
+        }
+
+        t_delivering_watcher = this;
+        try {
+            callback_(event);
+        } catch (const std::exception& e) {
+            LOG(ERROR) << "Exception in rank watcher callback: " << e.what();
+        } catch (...) {
+            LOG(ERROR) << "Unknown exception in rank watcher callback";
+        }
+        t_delivering_watcher = nullptr;
+    }
+
+    void on_done(const grpc::Status& status) override {
+        if (!status.ok() && status.error_code() != grpc::StatusCode::CANCELLED) {
+            LOG(WARNING) << "Rank watcher stream ended: " << status.error_message()
+                         << " (code: " << static_cast<int>(status.error_code()) << ")";
+        } else {
+            VLOG(1) << "Rank watcher stream closed";
+        }
+    }
+
+private:
+    std::shared_ptr<grpc::Channel> channel_;
+    std::unique_ptr<::ascnd::v1::AscndService::Stub> stub_;
+    RankChangeCallback callback_;
+
+    // Taken before mutex_ when both are held
+    std::mutex delivery_mutex_;
+    std::set<std::pair<std::string, std::string>> watched_;
+    uint64_t delivered_ = 0;
+};
+
+// ============================================================================
+// RankWatcher
+// ============================================================================
+
+std::unique_ptr<RankWatcher> RankWatcher::open(
+    const std::shared_ptr<grpc::Channel>& channel,
+    std::unique_ptr<grpc::ClientContext> context,
+    RankChangeCallback callback
+) {
+    auto impl = std::make_unique<Impl>(channel, std::move(context), std::move(callback));
+    impl->start();
+    return std::unique_ptr<RankWatcher>(new RankWatcher(std::move(impl)));
+}
+
+RankWatcher::RankWatcher(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+RankWatcher::~RankWatcher() {
+    // The reactor must reach OnDone before it can be destroyed
+    impl_->shutdown();
+}
+
+bool RankWatcher::watch(const std::string& leaderboard_id,
+                        const std::vector<std::string>& player_ids) {
+    return impl_->update(leaderboard_id, player_ids, /*add=*/true);
+}
+
+bool RankWatcher::unwatch(const std::string& leaderboard_id,
+                          const std::vector<std::string>& player_ids) {
+    return impl_->update(leaderboard_id, player_ids, /*add=*/false);
+}
+
+Result<uint64_t> RankWatcher::close() {
+    return impl_->close();
+}
+
+bool RankWatcher::is_open() const {
+    return impl_->accepts_writes();
+}
+
+size_t RankWatcher::watched_count() const {
+    return impl_->watched_count();
+}
+
+} // namespace ascnd
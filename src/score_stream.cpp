@@ -0,0 +1,217 @@
+/**
+ * @file score_stream.cpp
+ * @brief Implementation of the SubmitScoreStream client
+ */
+
+#include "ascnd/score_stream.hpp"
+#include "ascnd.grpc.pb.h"
+#include "bidi_stream.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace ascnd {
+
+namespace {
+
+Result<SubmitScoreResponse> ToResult(const SubmitScoreResult& result) {
+    if (result.error_code() != 0) {
+        return Result<SubmitScoreResponse>::error(result.error_message(), result.error_code());
+    }
+    return Result<SubmitScoreResponse>::ok(result.response());
+}
+
+}  // namespace
+
+// ============================================================================
+// Stream Reactor
+// ============================================================================
+
+// Every accepted write is tracked until the server acknowledges it or the
+// stream ends, so that each sequence number sees exactly one callback.
+class ScoreStream::Impl : public BidiStream<ScoreStreamRequest, ScoreStreamAck> {
+public:
+    Impl(std::shared_ptr<grpc::Channel> channel,
+         std::unique_ptr<grpc::ClientContext> context,
+         ScoreAckCallback callback,
+         ScoreStreamOptions options)
+        : BidiStream(std::move(context)),
+          channel_(std::move(channel)),
+          stub_(::ascnd::v1::AscndService::NewStub(channel_)),
+          callback_(std::move(callback)),
+          options_(options) {}
+
+    void start() {
+        BidiStream::start([this](grpc::ClientContext* context, auto* reactor) {
+            stub_->async()->SubmitScoreStream(context, reactor);
+        });
+    }
+
+    Result<uint64_t> write(const SubmitScoreRequest& request, bool block) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (block) {
+            cv_.wait(lock, [this]() { return !accepts_writes_locked() || has_capacity(); });
+        }
+        if (!accepts_writes_locked()) {
+            return Result<uint64_t>::error("Score stream is closed",
+                                           static_cast<int>(grpc::StatusCode::FAILED_PRECONDITION));
+        }
+        if (!has_capacity()) {
+            return Result<uint64_t>::error("Score stream has too many submissions in flight",
+                                           static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+        }
+
+        uint64_t sequence = next_sequence_++;
+        ScoreStreamRequest message;
+        message.set_sequence(sequence);
+        *message.mutable_submission() = request;
+        outstanding_.insert(sequence);
+
+        write_locked(lock, std::move(message));
+        return Result<uint64_t>::ok(sequence);
+    }
+
+    Result<uint64_t> finish() {
+        close_writes();
+        return to_result(wait_done());
+    }
+
+    void shutdown() {
+        cancel();
+        wait_done();
+    }
+
+    uint64_t in_flight() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return outstanding_.size();
+    }
+
+protected:
+    void on_read(ScoreStreamAck& ack) override {
+        uint64_t sequence = ack.sequence();
+        bool known = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            known = outstanding_.erase(sequence) > 0;
+            if (known) {
+                ++acknowledged_;
+                cv_.notify_all();
+            }
+        }
+
+        if (known) {
+            deliver(sequence, ToResult(ack.result()));
+        } else {
+            LOG(WARNING) << "Ignoring acknowledgement for unknown sequence " << sequence;
+        }
+    }
+
+    void on_done(const grpc::Status& status) override {
+        std::vector<uint64_t> unacknowledged;
+        uint64_t acknowledged = 0;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            unacknowledged.assign(outstanding_.begin(), outstanding_.end());
+            outstanding_.clear();
+            acknowledged = acknowledged_;
+        }
+
+        if (!status.ok()) {
+            LOG(WARNING) << "Score stream ended: " << status.error_message()
+                         << " (code: " << static_cast<int>(status.error_code()) << ")";
+        } else {
+            VLOG(1) << "Score stream finished after " << acknowledged << " acknowledgements";
+        }
+
+        // Whatever the server did not acknowledge is reported as failed
+        std::string message = status.ok() ? "Score stream closed before acknowledgement"
+                                          : status.error_message();
+        int code = status.ok() ? static_cast<int>(grpc::StatusCode::ABORTED)
+                               : static_cast<int>(status.error_code());
+        std::sort(unacknowledged.begin(), unacknowledged.end());
+        for (uint64_t sequence : unacknowledged) {
+            deliver(sequence, Result<SubmitScoreResponse>::error(message, code));
+        }
+    }
+
+private:
+    bool has_capacity() const {
+        return outstanding_.size() < static_cast<size_t>(options_.max_in_flight);
+    }
+
+    void deliver(uint64_t sequence, Result<SubmitScoreResponse> result) {
+        try {
+            callback_(sequence, std::move(result));
+        } catch (const std::exception& e) {
+            LOG(ERROR) << "Exception in score stream callback: " << e.what();
+        } catch (...) {
+            LOG(ERROR) << "Unknown exception in score stream callback";
+        }
+    }
+
+    Result<uint64_t> to_result(const grpc::Status& status) {
+        if (!status.ok()) {
+            return Result<uint64_t>::error(status.error_message(),
+                                           static_cast<int>(status.error_code()));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        return Result<uint64_t>::ok(acknowledged_);
+    }
+
+    std::shared_ptr<grpc::Channel> channel_;
+    std::unique_ptr<::ascnd::v1::AscndService::Stub> stub_;
+    ScoreAckCallback callback_;
+    ScoreStreamOptions options_;
+
+    uint64_t next_sequence_ = 1;
+    uint64_t acknowledged_ = 0;
+    std::unordered_set<uint64_t> outstanding_;
+};
+
+// ============================================================================
+// ScoreStream
+// ============================================================================
+
+std::unique_ptr<ScoreStream> ScoreStream::open(
+    const std::shared_ptr<grpc::Channel>& channel,
+    std::unique_ptr<grpc::ClientContext> context,
+    ScoreAckCallback callback,
+    ScoreStreamOptions options
+) {
+    auto impl = std::make_unique<Impl>(channel, std::move(context), std::move(callback), options);
+    impl->start();
+    return std::unique_ptr<ScoreStream>(new ScoreStream(std::move(impl)));
+}
+
+ScoreStream::ScoreStream(std::unique_ptr<Impl> impl) : impl_(std::move(impl)) {}
+
+ScoreStream::~ScoreStream() {
+    // The reactor must reach OnDone before it can be destroyed
+    impl_->shutdown();
+}
+
+Result<uint64_t> ScoreStream::write(const SubmitScoreRequest& request) {
+    return impl_->write(request, /*block=*/true);
+}
+
+Result<uint64_t> ScoreStream::try_write(const SubmitScoreRequest& request) {
+    return impl_->write(request, /*block=*/false);
+}
+
+Result<uint64_t> ScoreStream::finish() {
+    return impl_->finish();
+}
+
+bool ScoreStream::is_open() const {
+    return impl_->accepts_writes();
+}
+
+uint64_t ScoreStream::in_flight() const {
+    return impl_->in_flight();
+}
+
+} // namespace ascnd
@@ -0,0 +1,102 @@
+/**
+ * @file score_validator.cpp
+ * @brief Implementation of the client-side score validator
+ */
+
+#include "score_validator.hpp"
+
+#include <sstream>
+#include <utility>
+
+namespace ascnd {
+
+namespace {
+
+AnticheatViolation MakeViolation(const std::string& flag_type, const std::string& reason) {
+    AnticheatViolation violation;
+    violation.set_flag_type(flag_type);
+    violation.set_reason(reason);
+    return violation;
+}
+
+}  // anonymous namespace
+
+ScoreValidator::ScoreValidator() : last_submissions_(kMaxTrackedPlayers) {}
+
+bool ScoreValidator::cached_rules(const std::string& leaderboard_id,
+                                  Clock::time_point now,
+                                  std::shared_ptr<const GetLeaderboardRulesResponse>* rules) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto it = rules_.find(leaderboard_id);
+    if (it == rules_.end() || it->second.expires <= now) {
+        return false;
+    }
+    *rules = it->second.rules;
+    return true;
+}
+
+void ScoreValidator::store_rules(const std::string& leaderboard_id,
+                                 std::shared_ptr<const GetLeaderboardRulesResponse> rules,
+                                 Clock::time_point expires) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    rules_[leaderboard_id] = CachedRules{std::move(rules), expires};
+}
+
+std::vector<AnticheatViolation> ScoreValidator::check(const SubmitScoreRequest& request,
+                                                      const GetLeaderboardRulesResponse& rules,
+                                                      Clock::time_point now) {
+    std::vector<AnticheatViolation> violations;
+    const int64_t score = request.score();
+
+    if (rules.has_min_score() && score < rules.min_score()) {
+        std::ostringstream reason;
+        reason << "Score " << score << " is below the minimum of " << rules.min_score();
+        violations.push_back(MakeViolation("bounds_exceeded", reason.str()));
+    }
+    if (rules.has_max_score() && score > rules.max_score()) {
+        std::ostringstream reason;
+        reason << "Score " << score << " is above the maximum of " << rules.max_score();
+        violations.push_back(MakeViolation("bounds_exceeded", reason.str()));
+    }
+    if (rules.require_idempotency_key() && !request.has_idempotency_key()) {
+        violations.push_back(MakeViolation("missing_idempotency_key",
+                                           "Submissions to this leaderboard require an idempotency key"));
+    }
+
+    if (rules.has_max_score_per_second()) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        const LastSubmission* last = last_submissions_.find(player_key(request));
+        if (last && score > last->score) {
+            double elapsed = std::chrono::duration<double>(now - last->time).count();
+            double increase = static_cast<double>(score) - static_cast<double>(last->score);
+            if (increase > rules.max_score_per_second() * elapsed) {
+                std::ostringstream reason;
+                reason << "Score increased by " << increase << " in " << elapsed
+                       << "s, faster than the limit of " << rules.max_score_per_second()
+                       << " per second";
+                violations.push_back(MakeViolation("velocity_exceeded", reason.str()));
+            }
+        }
+    }
+
+    return violations;
+}
+
+void ScoreValidator::record(const SubmitScoreRequest& request,
+                            const GetLeaderboardRulesResponse& rules,
+                            Clock::time_point now) {
+    if (!rules.has_max_score_per_second()) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(mutex_);
+    last_submissions_.put(player_key(request), LastSubmission{request.score(), now});
+}
+
+std::string ScoreValidator::player_key(const SubmitScoreRequest& request) {
+    std::string key = request.leaderboard_id();
+    key.push_back('\0');
+    key += request.player_id();
+    return key;
+}
+
+} // namespace ascnd
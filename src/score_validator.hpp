@@ -0,0 +1,95 @@
+#pragma once
+
+/**
+ * @file score_validator.hpp
+ * @brief Client-side check of submissions against cached leaderboard rules
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/types.hpp"
+#include "lru_map.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ascnd {
+
+/**
+ * @brief Caches leaderboard rules and checks submissions against them
+ *
+ * Mirrors the server's bounds, velocity and idempotency key checks so that
+ * obviously invalid scores can be caught before they are sent. Velocity is
+ * judged against the last accepted submission of each player, remembered for
+ * a bounded number of players. Thread-safe.
+ */
+class ScoreValidator {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Players whose last submission is remembered for velocity checks
+    static constexpr size_t kMaxTrackedPlayers = 10000;
+
+    ScoreValidator();
+
+    /**
+     * @brief Look up the cached rules of a leaderboard
+     * @param leaderboard_id Leaderboard identifier
+     * @param now Current time
+     * @param rules Receives the rules, or null if the leaderboard's rules
+     *        are known to be unavailable
+     * @return false if nothing is cached or the cached entry expired
+     */
+    bool cached_rules(const std::string& leaderboard_id,
+                      Clock::time_point now,
+                      std::shared_ptr<const GetLeaderboardRulesResponse>* rules) const;
+
+    /**
+     * @brief Cache the rules of a leaderboard
+     * @param leaderboard_id Leaderboard identifier
+     * @param rules Rules to cache, or null to remember that none are available
+     * @param expires Time after which the rules must be fetched again
+     */
+    void store_rules(const std::string& leaderboard_id,
+                     std::shared_ptr<const GetLeaderboardRulesResponse> rules,
+                     Clock::time_point expires);
+
+    /**
+     * @brief Check a submission against a leaderboard's rules
+     * @return The rules the submission breaks; empty if it passes
+     */
+    std::vector<AnticheatViolation> check(const SubmitScoreRequest& request,
+                                          const GetLeaderboardRulesResponse& rules,
+                                          Clock::time_point now);
+
+    /**
+     * @brief Remember a submission that is being sent, for velocity checks
+     */
+    void record(const SubmitScoreRequest& request,
+                const GetLeaderboardRulesResponse& rules,
+                Clock::time_point now);
+
+private:
+    struct CachedRules {
+        std::shared_ptr<const GetLeaderboardRulesResponse> rules;
+        Clock::time_point expires;
+    };
+
+    struct LastSubmission {
+        int64_t score;
+        Clock::time_point time;
+    };
+
+    static std::string player_key(const SubmitScoreRequest& request);
+
+    mutable std::mutex mutex_;
+    std::map<std::string, CachedRules> rules_;
+    LruMap<std::string, LastSubmission> last_submissions_;
+};
+
+} // namespace ascnd
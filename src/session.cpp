@@ -0,0 +1,222 @@
+/**
+ * @file session.cpp
+ * @brief Implementation of the multiplexed Session stream
+ */
+
+#include "session.hpp"
+#include "bidi_stream.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <future>
+#include <unordered_map>
+#include <utility>
+
+namespace ascnd {
+
+using ::ascnd::v1::SessionRequest;
+using ::ascnd::v1::SessionResponse;
+
+// ============================================================================
+// Stream Reactor
+// ============================================================================
+
+// Each pending request owns a promise fulfilled by its response or, if the
+// stream ends first, by the stream's status.
+class Session::Stream : public BidiStream<SessionRequest, SessionResponse> {
+public:
+    struct Reply {
+        grpc::Status status;
+        SessionResponse response;
+    };
+
+    Stream(::ascnd::v1::AscndService::Stub* stub,
+           std::unique_ptr<grpc::ClientContext> context,
+           std::atomic<bool>* supported,
+           const ThreadHook* on_completion_thread)
+        : BidiStream(std::move(context)), stub_(stub), supported_(supported),
+          on_completion_thread_(on_completion_thread) {}
+
+    void start() {
+        BidiStream::start([this](grpc::ClientContext* context, auto* reactor) {
+            stub_->async()->Session(context, reactor);
+        });
+    }
+
+    // Queues the request unless the stream is closed; request and promise
+    // are only consumed on success
+    bool send(SessionRequest& request, std::promise<Reply>& promise) {
+        std::unique_lock<std::mutex> lock(mutex_);
+        if (!accepts_writes_locked()) {
+            return false;
+        }
+        pending_.emplace(request.request_id(), std::move(promise));
+        write_locked(lock, std::move(request));
+        return true;
+    }
+
+    // Forgets a request that timed out; false if its reply is already set
+    bool abandon(uint64_t request_id) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return pending_.erase(request_id) > 0;
+    }
+
+protected:
+    void on_read(SessionResponse& response) override {
+        if (*on_completion_thread_) {
+            (*on_completion_thread_)();
+        }
+        std::promise<Reply> promise;
+        bool known = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            received_any_ = true;
+            auto it = pending_.find(response.request_id());
+            if (it != pending_.end()) {
+                promise = std::move(it->second);
+                pending_.erase(it);
+                known = true;
+            }
+        }
+
+        if (known) {
+            promise.set_value(Reply{grpc::Status::OK, std::move(response)});
+        } else {
+            VLOG(1) << "Dropping session response for request " << response.request_id();
+        }
+    }
+
+    void on_done(const grpc::Status& status) override {
+        std::unordered_map<uint64_t, std::promise<Reply>> unanswered;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            unanswered.swap(pending_);
+            if (status.error_code() == grpc::StatusCode::UNIMPLEMENTED && !received_any_) {
+                supported_->store(false);
+            }
+        }
+
+        if (!status.ok() && status.error_code() != grpc::StatusCode::CANCELLED) {
+            LOG(WARNING) << "Session stream ended: " << status.error_message()
+                         << " (code: " << static_cast<int>(status.error_code()) << ")";
+        } else {
+            VLOG(1) << "Session stream closed";
+        }
+
+        // A stream that ends cleanly with requests outstanding is treated as
+        // unavailable so that the caller's retry policy applies
+        grpc::Status failure = status.ok()
+            ? grpc::Status(grpc::StatusCode::UNAVAILABLE, "Session stream closed")
+            : status;
+        for (auto& entry : unanswered) {
+            entry.second.set_value(Reply{failure, SessionResponse()});
+        }
+    }
+
+private:
+    ::ascnd::v1::AscndService::Stub* stub_;
+    std::atomic<bool>* supported_;
+    const ThreadHook* on_completion_thread_;  // Owned by the Session
+
+    std::unordered_map<uint64_t, std::promise<Reply>> pending_;
+    bool received_any_ = false;
+};
+
+// ============================================================================
+// Session
+// ============================================================================
+
+Session::Session(std::shared_ptr<grpc::Channel> channel, ContextFactory context_factory,
+                 ThreadHook on_completion_thread)
+    : stub_(::ascnd::v1::AscndService::NewStub(channel)),
+      context_factory_(std::move(context_factory)),
+      on_completion_thread_(std::move(on_completion_thread)) {}
+
+Session::~Session() {
+    std::vector<std::shared_ptr<Stream>> streams;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        streams.swap(retired_);
+        if (current_) {
+            streams.push_back(std::move(current_));
+        }
+    }
+    // Reactors must reach OnDone before they can be destroyed
+    for (auto& stream : streams) {
+        stream->cancel();
+        stream->wait_done();
+    }
+}
+
+std::shared_ptr<Session::Stream> Session::acquire_stream() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (current_ && current_->accepts_writes()) {
+        return current_;
+    }
+
+    retired_.erase(
+        std::remove_if(retired_.begin(), retired_.end(),
+                       [](const std::shared_ptr<Stream>& stream) { return stream->is_done(); }),
+        retired_.end());
+    if (current_) {
+        retired_.push_back(std::move(current_));
+    }
+
+    VLOG(1) << "Opening session stream";
+    current_ = std::make_shared<Stream>(stub_.get(), context_factory_(), &supported_,
+                                        &on_completion_thread_);
+    current_->start();
+    return current_;
+}
+
+void Session::reset() {
+    std::shared_ptr<Stream> stream;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!current_) {
+            return;
+        }
+        stream = current_;
+        retired_.push_back(std::move(current_));
+    }
+    stream->close_writes();
+}
+
+grpc::Status Session::call(SessionRequest request,
+                           SessionResponse* response,
+                           std::chrono::system_clock::time_point deadline) {
+    // A stream can close between being acquired and being written to; the
+    // request then moves to a fresh stream once
+    for (int attempt = 0; attempt < 2; ++attempt) {
+        auto stream = acquire_stream();
+        uint64_t request_id = next_request_id_++;
+        request.set_request_id(request_id);
+
+        std::promise<Stream::Reply> promise;
+        auto future = promise.get_future();
+        if (!stream->send(request, promise)) {
+            continue;
+        }
+
+        if (future.wait_until(deadline) == std::future_status::timeout &&
+            stream->abandon(request_id)) {
+            return grpc::Status(grpc::StatusCode::DEADLINE_EXCEEDED, "Deadline Exceeded");
+        }
+
+        Stream::Reply reply = future.get();
+        if (!reply.status.ok()) {
+            return reply.status;
+        }
+        if (reply.response.error_code() != 0) {
+            return grpc::Status(static_cast<grpc::StatusCode>(reply.response.error_code()),
+                                reply.response.error_message());
+        }
+        *response = std::move(reply.response);
+        return grpc::Status::OK;
+    }
+
+    return grpc::Status(grpc::StatusCode::UNAVAILABLE, "Session stream closed");
+}
+
+} // namespace ascnd
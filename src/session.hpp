@@ -0,0 +1,88 @@
+#pragma once
+
+/**
+ * @file session.hpp
+ * @brief Multiplexed Session stream used by AscndClient in session mode
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd.grpc.pb.h"
+
+#include <grpcpp/grpcpp.h>
+
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ascnd {
+
+/**
+ * @brief Carries tagged requests over one long-lived Session stream
+ *
+ * call() is thread-safe; concurrent calls are pipelined on the same stream
+ * and complete in whatever order the server answers them. A stream that
+ * ends is replaced by a fresh one on the next call.
+ */
+class Session {
+public:
+    /// Creates the context (metadata, no deadline) for each new stream
+    using ContextFactory = std::function<std::unique_ptr<grpc::ClientContext>()>;
+
+    /// Runs on the gRPC thread before each response is handled
+    using ThreadHook = std::function<void()>;
+
+    Session(std::shared_ptr<grpc::Channel> channel, ContextFactory context_factory,
+            ThreadHook on_completion_thread = nullptr);
+    ~Session();
+
+    Session(const Session&) = delete;
+    Session& operator=(const Session&) = delete;
+
+    /**
+     * @brief Send a request and wait for its response
+     * @param request Request to send; its request_id is assigned here
+     * @param response Receives the response on success
+     * @param deadline Time after which the call gives up
+     * @return Per-request status from the server, or the stream's status if
+     *         the stream ended before answering
+     */
+    grpc::Status call(::ascnd::v1::SessionRequest request,
+                      ::ascnd::v1::SessionResponse* response,
+                      std::chrono::system_clock::time_point deadline);
+
+    /**
+     * @brief Close the current stream; the next call opens a new one
+     *
+     * Used when stream metadata such as the API key changes. Calls already
+     * in flight on the old stream complete normally.
+     */
+    void reset();
+
+    /**
+     * @brief False once the server has rejected the Session RPC as unimplemented
+     */
+    [[nodiscard]] bool supported() const { return supported_.load(); }
+
+private:
+    class Stream;
+
+    std::shared_ptr<Stream> acquire_stream();
+
+    std::unique_ptr<::ascnd::v1::AscndService::Stub> stub_;
+    ContextFactory context_factory_;
+    ThreadHook on_completion_thread_;
+
+    std::mutex mutex_;
+    std::shared_ptr<Stream> current_;
+    // Closed streams still finishing their last reactions
+    std::vector<std::shared_ptr<Stream>> retired_;
+
+    std::atomic<uint64_t> next_request_id_{1};
+    std::atomic<bool> supported_{true};
+};
+
+} // namespace ascnd
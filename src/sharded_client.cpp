@@ -0,0 +1,71 @@
+/**
+ * @file sharded_client.cpp
+ * @brief Implementation of per-thread client shards
+ */
+
+#include "ascnd/sharded_client.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+namespace ascnd {
+
+namespace {
+
+// Threads are numbered in the order they first use any ShardedClient; a
+// thread's number picks its shard, so it keeps the same one
+std::atomic<size_t> g_next_thread_slot{0};
+
+size_t ThreadSlot() {
+    thread_local const size_t slot = g_next_thread_slot++;
+    return slot;
+}
+
+}  // anonymous namespace
+
+ShardedClient::ShardedClient(ClientConfig config, size_t shards) {
+    if (shards == 0) {
+        shards = std::max(1u, std::thread::hardware_concurrency());
+    }
+    config.dedicated_connection = true;
+
+    shards_.reserve(shards);
+    for (size_t i = 0; i < shards; ++i) {
+        shards_.push_back(std::make_unique<AscndClient>(config));
+    }
+    VLOG(1) << "Created " << shards << " client shards";
+}
+
+ShardedClient::~ShardedClient() = default;
+
+AscndClient& ShardedClient::local() {
+    return *shards_[ThreadSlot() % shards_.size()];
+}
+
+AscndClient& ShardedClient::shard(size_t index) {
+    if (index >= shards_.size()) {
+        throw std::out_of_range("shard index " + std::to_string(index) + " out of range");
+    }
+    return *shards_[index];
+}
+
+void ShardedClient::set_api_key(const std::string& api_key) {
+    for (auto& shard : shards_) {
+        shard->set_api_key(api_key);
+    }
+}
+
+ClientStats ShardedClient::stats() const {
+    ClientStats total;
+    for (const auto& shard : shards_) {
+        total += shard->stats();
+    }
+    return total;
+}
+
+} // namespace ascnd
@@ -0,0 +1,78 @@
+#pragma once
+
+/**
+ * @file striped_counters.hpp
+ * @brief Event counters that many threads can bump without sharing cache lines
+ *
+ * Internal to the library; not installed.
+ */
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace ascnd {
+
+/// Assumed cache line size; 64 bytes on x86-64 and most ARM cores
+constexpr size_t kCacheLineSize = 64;
+
+/**
+ * @brief A fixed set of counters, striped across cache lines
+ *
+ * Each thread adds to the counters of its own stripe, a cache-line-aligned
+ * block picked once per thread, so concurrent increments from different
+ * threads do not invalidate each other's cache lines. Reading sums all
+ * stripes and is correspondingly slower; it is meant for occasional stats
+ * snapshots. Increments are relaxed: a snapshot taken while counters are
+ * being bumped may miss the latest ones. Thread-safe.
+ *
+ * @tparam Count Number of counters, indexed 0 to Count - 1
+ */
+template<size_t Count>
+class StripedCounters {
+public:
+    /// Stripes per counter set. Threads beyond this share stripes.
+    static constexpr size_t kStripes = 64;
+
+    StripedCounters() {
+        for (auto& stripe : stripes_) {
+            for (auto& value : stripe.values) {
+                value.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    StripedCounters(const StripedCounters&) = delete;
+    StripedCounters& operator=(const StripedCounters&) = delete;
+
+    void add(size_t counter, uint64_t amount = 1) noexcept {
+        stripes_[thread_stripe()].values[counter].fetch_add(amount, std::memory_order_relaxed);
+    }
+
+    /// Total of one counter over all stripes
+    [[nodiscard]] uint64_t sum(size_t counter) const noexcept {
+        uint64_t total = 0;
+        for (const auto& stripe : stripes_) {
+            total += stripe.values[counter].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+private:
+    struct alignas(kCacheLineSize) Stripe {
+        std::array<std::atomic<uint64_t>, Count> values;
+    };
+
+    // Threads are numbered in the order they first bump a counter set of
+    // this size, so the first kStripes such threads get a stripe each
+    static size_t thread_stripe() noexcept {
+        static std::atomic<size_t> next_thread{0};
+        thread_local const size_t stripe = next_thread.fetch_add(1, std::memory_order_relaxed) % kStripes;
+        return stripe;
+    }
+
+    std::array<Stripe, kStripes> stripes_;
+};
+
+} // namespace ascnd
@@ -0,0 +1,38 @@
+/**
+ * @file submission_throttle.cpp
+ * @brief Implementation of the per-player submission throttle
+ */
+
+#include "submission_throttle.hpp"
+
+namespace ascnd {
+
+SubmissionThrottle::SubmissionThrottle(int limit, Clock::duration window)
+    : limit_(static_cast<size_t>(limit)), window_(window), sent_(kMaxTrackedPlayers) {}
+
+bool SubmissionThrottle::try_acquire(const std::string& leaderboard_id,
+                                     const std::string& player_id,
+                                     Clock::time_point now,
+                                     Clock::time_point* next_slot) {
+    std::string key = leaderboard_id;
+    key.push_back('\0');
+    key += player_id;
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto* sent = sent_.find(key);
+    if (!sent) {
+        sent = &sent_.put(key, {});
+    }
+
+    while (!sent->empty() && sent->front() + window_ <= now) {
+        sent->pop_front();
+    }
+    if (sent->size() >= limit_) {
+        *next_slot = sent->front() + window_;
+        return false;
+    }
+    sent->push_back(now);
+    return true;
+}
+
+} // namespace ascnd
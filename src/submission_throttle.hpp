@@ -0,0 +1,61 @@
+#pragma once
+
+/**
+ * @file submission_throttle.hpp
+ * @brief Per-player sliding-window limit on score submissions
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "lru_map.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <mutex>
+#include <string>
+
+namespace ascnd {
+
+/**
+ * @brief Limits submissions per (leaderboard, player) within a sliding window
+ *
+ * Send times are remembered for a bounded number of recently active
+ * players; a player evicted from the LRU starts with an empty window.
+ * Thread-safe.
+ */
+class SubmissionThrottle {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /// Players whose recent submissions are remembered
+    static constexpr size_t kMaxTrackedPlayers = 10000;
+
+    /**
+     * @param limit Submissions allowed per player within one window
+     * @param window Length of the sliding window
+     */
+    SubmissionThrottle(int limit, Clock::duration window);
+
+    /**
+     * @brief Claim a slot for a submission
+     * @param leaderboard_id Leaderboard identifier
+     * @param player_id Player identifier
+     * @param now Current time
+     * @param next_slot Receives the time a slot frees up if none is free now
+     * @return true if the submission may be sent now; its send time is recorded
+     */
+    bool try_acquire(const std::string& leaderboard_id,
+                     const std::string& player_id,
+                     Clock::time_point now,
+                     Clock::time_point* next_slot);
+
+private:
+    const size_t limit_;
+    const Clock::duration window_;
+
+    std::mutex mutex_;
+    LruMap<std::string, std::deque<Clock::time_point>> sent_;
+};
+
+} // namespace ascnd
@@ -0,0 +1,120 @@
+/**
+ * @file thread_affinity.cpp
+ * @brief Implementation of CPU and NUMA node thread pinning
+ */
+
+#include "thread_affinity.hpp"
+
+#include <glog/logging.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+#if defined(__linux__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+namespace ascnd {
+
+namespace {
+
+// CPU set the calling thread was last pinned to (0: none)
+thread_local uint64_t t_pinned_to = 0;
+
+// CPUs of a NUMA node, empty if the node does not exist
+std::vector<int> NodeCpus(int node) {
+    std::ifstream file("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+    std::string list;
+    if (!file || !std::getline(file, list)) {
+        return {};
+    }
+    return ThreadPinner::parse_cpu_list(list);
+}
+
+// Process-wide id of a CPU set, the same for every pinner using that set,
+// so that threads shared by several clients are pinned only once
+uint64_t CpuSetId(const std::vector<int>& cpus) {
+    static std::mutex mutex;
+    static std::map<std::vector<int>, uint64_t> ids;
+    std::lock_guard<std::mutex> lock(mutex);
+    return ids.emplace(cpus, ids.size() + 1).first->second;
+}
+
+}  // anonymous namespace
+
+ThreadPinner::ThreadPinner(const ThreadAffinity& affinity)
+    : cpus_(affinity.cpus) {
+    for (int node : affinity.numa_nodes) {
+        std::vector<int> node_cpus = NodeCpus(node);
+        if (node_cpus.empty()) {
+            LOG(WARNING) << "NUMA node " << node << " not found; ignoring it for thread affinity";
+        }
+        cpus_.insert(cpus_.end(), node_cpus.begin(), node_cpus.end());
+    }
+    std::sort(cpus_.begin(), cpus_.end());
+    cpus_.erase(std::unique(cpus_.begin(), cpus_.end()), cpus_.end());
+
+#if !defined(__linux__)
+    if (!cpus_.empty()) {
+        LOG(WARNING) << "Thread affinity is only supported on Linux; threads are left unpinned";
+        cpus_.clear();
+    }
+#endif
+    id_ = CpuSetId(cpus_);
+}
+
+void ThreadPinner::pin_current_thread() const {
+    if (cpus_.empty() || t_pinned_to == id_) {
+        return;
+    }
+    // Marked before trying so that a failing set is not retried on every call
+    t_pinned_to = id_;
+
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int cpu : cpus_) {
+        if (cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    int error = pthread_setaffinity_np(pthread_self(), sizeof(set), &set);
+    if (error != 0) {
+        static std::atomic<bool> warned{false};
+        if (!warned.exchange(true)) {
+            LOG(WARNING) << "Could not set thread affinity: " << std::strerror(error);
+        }
+    }
+#endif
+}
+
+std::vector<int> ThreadPinner::parse_cpu_list(const std::string& list) {
+    std::vector<int> cpus;
+    std::istringstream ranges(list);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+        int first = 0;
+        int last = 0;
+        char dash = 0;
+        std::istringstream parts(range);
+        if (!(parts >> first) || first < 0) {
+            return {};
+        }
+        last = first;
+        if (parts >> dash && (dash != '-' || !(parts >> last) || last < first)) {
+            return {};
+        }
+        for (int cpu = first; cpu <= last; ++cpu) {
+            cpus.push_back(cpu);
+        }
+    }
+    return cpus;
+}
+
+} // namespace ascnd
@@ -0,0 +1,58 @@
+#pragma once
+
+/**
+ * @file thread_affinity.hpp
+ * @brief Pinning of client threads to CPUs or NUMA nodes
+ *
+ * Internal to the library; not installed.
+ */
+
+#include "ascnd/client.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace ascnd {
+
+/**
+ * @brief Pins threads to the CPUs selected by a ThreadAffinity
+ *
+ * The CPU set is resolved once, at construction. Pinning is a hint: if the
+ * platform does not support it or the set is unusable, threads are left
+ * unpinned and a warning is logged once. Thread-safe.
+ */
+class ThreadPinner {
+public:
+    explicit ThreadPinner(const ThreadAffinity& affinity);
+
+    /// Whether there is anything to pin to
+    [[nodiscard]] bool enabled() const { return !cpus_.empty(); }
+
+    /// Resolved CPUs, in ascending order
+    [[nodiscard]] const std::vector<int>& cpus() const { return cpus_; }
+
+    /**
+     * @brief Pin the calling thread
+     *
+     * Cheap after the first call on a thread for the same CPU set, from
+     * this or any other pinner, so it can be called each time a shared
+     * thread runs client code.
+     */
+    void pin_current_thread() const;
+
+    /**
+     * @brief Parse a Linux CPU list such as "0-3,8,10-11"
+     * @return The CPUs, or an empty vector if the list is malformed
+     */
+    static std::vector<int> parse_cpu_list(const std::string& list);
+
+private:
+    std::vector<int> cpus_;
+
+    // Identifies this CPU set to the per-thread "already pinned" marker;
+    // pinners with equal sets share it
+    uint64_t id_ = 0;
+};
+
+} // namespace ascnd
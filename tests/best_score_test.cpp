@@ -0,0 +1,269 @@
+/**
+ * @file best_score_test.cpp
+ * @brief Tests for filtering submissions that cannot beat a player's best
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace ascnd {
+namespace {
+
+class BestScoreTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+        config.best_score_filter = BestScoreFilter::kSkip;
+
+        set_rules("desc", "2999-01-01T00:00:00Z");
+    }
+
+    void set_rules(const std::string& sort_order, const std::string& period_end) {
+        GetLeaderboardRulesResponse rules;
+        rules.set_leaderboard_id("leaderboard");
+        rules.set_sort_order(sort_order);
+        if (!period_end.empty()) {
+            rules.set_period_end(period_end);
+        }
+        service.set_rules(rules);
+    }
+
+    static SubmitScoreRequest make_request(int64_t score) {
+        SubmitScoreRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player");
+        request.set_score(score);
+        return request;
+    }
+
+    // Waits until the server has seen count batches
+    bool wait_for_batches(int count) {
+        auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (service.batch_calls.load() < count) {
+            if (std::chrono::steady_clock::now() > deadline) {
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(5));
+        }
+        return true;
+    }
+};
+
+TEST_F(BestScoreTest, OffByDefault) {
+    config.best_score_filter = BestScoreFilter::kOff;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 400).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 2);
+    EXPECT_EQ(service.rules_calls.load(), 0);
+}
+
+TEST_F(BestScoreTest, SkipsScoresBelowSubmittedBest) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    auto skipped = client.submit_score("leaderboard", "player", 400);
+    auto tied = client.submit_score("leaderboard", "player", 500);
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 600).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "other-player", 100).is_ok());
+
+    ASSERT_TRUE(skipped.is_ok()) << skipped.error();
+    EXPECT_FALSE(skipped.value().is_new_best());
+    EXPECT_TRUE(skipped.value().score_id().empty());
+    EXPECT_TRUE(tied.is_ok());
+    EXPECT_EQ(service.submit_calls.load(), 3);
+    EXPECT_EQ(client.stats().submissions_skipped, 2u);
+}
+
+TEST_F(BestScoreTest, SeededFromPlayerRank) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());  // best_score 1000
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 900).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 0);
+    EXPECT_EQ(client.stats().submissions_skipped, 1u);
+}
+
+// Other periods and views do not report the current best
+TEST_F(BestScoreTest, IgnoresRanksOfOtherPeriods) {
+    AscndClient client(config);
+
+    GetPlayerRankRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_period("previous");
+    ASSERT_TRUE(client.get_player_rank(request).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 900).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+TEST_F(BestScoreTest, AscendingLeaderboards) {
+    set_rules("asc", "2999-01-01T00:00:00Z");
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 600).is_ok());  // Skipped
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 400).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+TEST_F(BestScoreTest, EndedPeriodsAreForgotten) {
+    set_rules("desc", "2000-01-01T00:00:00Z");
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 400).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+TEST_F(BestScoreTest, AllTimeLeaderboardsNeverExpire) {
+    set_rules("desc", "");
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 400).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+TEST_F(BestScoreTest, UnknownRulesDisableFiltering) {
+    service.rules_supported = false;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 400).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+TEST_F(BestScoreTest, BatchModeSendsNonImprovingScoresTogether) {
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.best_score_batch_delay_ms = 50;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+    for (int i = 0; i < 3; ++i) {
+        auto result = client.submit_score("leaderboard", "player", 100 + i);
+        ASSERT_TRUE(result.is_ok());
+        EXPECT_FALSE(result.value().is_new_best());
+    }
+
+    ASSERT_TRUE(wait_for_batches(1));
+    EXPECT_EQ(service.submit_calls.load(), 1);
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.submissions_batched, 3u);
+    EXPECT_EQ(stats.submit_batch_sizes.counts[1], 1u);    // 2 or 3 submissions
+    EXPECT_EQ(stats.submit_batch_windows.counts[7], 1u);  // 32 to 64 ms
+}
+
+TEST_F(BestScoreTest, AdaptiveBatchingSendsIdleSubmissionsAtOnce) {
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.best_score_batch_delay_ms = 60000;
+    config.adaptive_batching = true;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+
+    ASSERT_TRUE(wait_for_batches(1));
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.submit_batch_windows.counts[0], 1u);
+    EXPECT_EQ(stats.submit_batch_sizes.counts[0], 1u);
+}
+
+TEST_F(BestScoreTest, NonImprovingScoresAreThrottled) {
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.player_submission_limit = 1;
+    config.player_throttle_mode = ThrottleMode::kReject;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+    auto result = client.submit_score("leaderboard", "player", 500);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error_code(), static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.submissions_throttled, 1u);
+    EXPECT_EQ(stats.submissions_batched, 0u);
+}
+
+TEST_F(BestScoreTest, DeferredScoresAreFlushedOnDestruction) {
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.best_score_batch_delay_ms = 60000;
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+        EXPECT_EQ(service.batch_calls.load(), 0);
+    }
+    EXPECT_EQ(service.batch_calls.load(), 1);
+}
+
+TEST_F(BestScoreTest, FailedBatchesAreRetried) {
+    service.batch_failures = 1;
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.best_score_batch_delay_ms = 20;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+    std::promise<int> outcome;
+    client.submit_score_fire_and_forget(
+        make_request(500), [&outcome](int code, const std::string&) { outcome.set_value(code); });
+
+    EXPECT_EQ(outcome.get_future().get(), 0);
+    EXPECT_EQ(service.batch_calls.load(), 1);
+    EXPECT_EQ(client.stats().submissions_lost, 0u);
+}
+
+TEST_F(BestScoreTest, UndeliverableDeferredScoresAreReported) {
+    service.batch_failures = 100;
+    config.best_score_filter = BestScoreFilter::kBatch;
+    config.best_score_batch_delay_ms = 20;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+    std::promise<int> outcome;
+    client.submit_score_fire_and_forget(
+        make_request(500), [&outcome](int code, const std::string&) { outcome.set_value(code); });
+
+    EXPECT_EQ(outcome.get_future().get(), static_cast<int>(grpc::StatusCode::UNAVAILABLE));
+    EXPECT_EQ(service.batch_failures.load(), 97);  // Three attempts
+    EXPECT_EQ(client.stats().submissions_lost, 1u);
+}
+
+TEST_F(BestScoreTest, DeferredScoresFallBackToSingleSubmissions) {
+    service.batch_supported = false;
+    config.best_score_filter = BestScoreFilter::kBatch;
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", 1000).is_ok());
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", 500).is_ok());
+    }
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,254 @@
+/**
+ * @file c_api_test.c
+ * @brief Tests for the C API, compiled as C
+ *
+ * Run by c_api_driver with the address of a fake server.
+ */
+
+#include "ascnd/ascnd_c.h"
+
+#include <stdio.h>
+#include <string.h>
+
+static int failures = 0;
+
+#define CHECK(condition)                                                   \
+    do {                                                                   \
+        if (!(condition)) {                                                \
+            fprintf(stderr, "%s:%d: CHECK failed: %s\n", __FILE__, __LINE__, #condition); \
+            ++failures;                                                    \
+        }                                                                  \
+    } while (0)
+
+static int string_equals(ascnd_string text, const char* expected) {
+    return text.size == strlen(expected) && memcmp(text.data, expected, text.size) == 0 &&
+           text.data[text.size] == '\0';
+}
+
+/* Callbacks copy what they need; views are only valid during the call */
+
+typedef struct submit_outcome {
+    int called;
+    int32_t error_code;
+    int ok;
+    int score_id_ok;
+    int32_t is_new_best;
+    size_t violation_count;
+} submit_outcome;
+
+static void on_submit(void* user_data, int32_t error_code, const char* error_message,
+                      const ascnd_submit_result* result) {
+    submit_outcome* outcome = (submit_outcome*)user_data;
+    outcome->called = 1;
+    outcome->error_code = error_code;
+    outcome->ok = result != NULL && error_message[0] == '\0';
+    if (result) {
+        outcome->score_id_ok = result->score_id.size > 6 && memcmp(result->score_id.data, "score-", 6) == 0;
+        outcome->is_new_best = result->is_new_best;
+        outcome->violation_count = result->violation_count;
+    }
+}
+
+typedef struct leaderboard_outcome {
+    int called;
+    int ok;
+    size_t entry_count;
+    size_t bracket_count;
+    int first_player_ok;
+    int64_t first_score;
+    int third_bracket_gold;
+    int fourth_bracket_silver;
+    int view_ok;
+} leaderboard_outcome;
+
+static void on_leaderboard(void* user_data, int32_t error_code, const char* error_message,
+                           const ascnd_leaderboard* result) {
+    leaderboard_outcome* outcome = (leaderboard_outcome*)user_data;
+    (void)error_message;
+    outcome->called = 1;
+    outcome->ok = error_code == 0 && result != NULL;
+    if (!result) {
+        return;
+    }
+    outcome->entry_count = result->entry_count;
+    outcome->bracket_count = result->bracket_count;
+    if (result->entry_count >= 4) {
+        const ascnd_entry* entries = result->entries;
+        outcome->first_player_ok = string_equals(entries[0].player_id, "player-1");
+        outcome->first_score = entries[0].score;
+        outcome->third_bracket_gold = entries[2].bracket >= 0 &&
+            string_equals(result->brackets[entries[2].bracket].name, "Gold");
+        outcome->fourth_bracket_silver = entries[3].bracket >= 0 &&
+            string_equals(result->brackets[entries[3].bracket].color, "#C0C0C0");
+    }
+    outcome->view_ok = string_equals(result->view_slug, "warriors") &&
+                       string_equals(result->view_name, "View warriors");
+}
+
+typedef struct rank_outcome {
+    int called;
+    int ok;
+    int32_t has_rank;
+    int32_t rank;
+    int32_t has_global_rank;
+    int32_t global_rank;
+} rank_outcome;
+
+static void on_rank(void* user_data, int32_t error_code, const char* error_message,
+                    const ascnd_player_rank* result) {
+    rank_outcome* outcome = (rank_outcome*)user_data;
+    (void)error_message;
+    outcome->called = 1;
+    outcome->ok = error_code == 0 && result != NULL;
+    if (result) {
+        outcome->has_rank = result->has_rank;
+        outcome->rank = result->rank;
+        outcome->has_global_rank = result->has_global_rank;
+        outcome->global_rank = result->global_rank;
+    }
+}
+
+static void test_config(const char* address) {
+    ascnd_config config;
+    ascnd_client* client;
+
+    ascnd_config_init(&config);
+    CHECK(config.struct_size == sizeof(ascnd_config));
+    CHECK(config.use_ssl == 1);
+    CHECK(config.max_retries == 3);
+
+    client = ascnd_client_create(&config);
+    CHECK(client == NULL);
+    CHECK(strlen(ascnd_last_error()) > 0);
+
+    config.server_address = address;
+    config.api_key = "test-key";
+    config.request_timeout_ms = -1;
+    client = ascnd_client_create(&config);
+    CHECK(client == NULL);
+    CHECK(strstr(ascnd_last_error(), "request_timeout_ms") != NULL);
+
+    ascnd_config_init(&config);
+    CHECK(config.tls_session_resumption == 1);
+    CHECK(config.connection_timeout_ms == 5000);
+    CHECK(config.tls_root_certs_pem == NULL);
+    config.server_address = address;
+    config.api_key = "test-key";
+    config.use_ssl = 0;
+    config.tls_client_cert_pem = "cert";
+    client = ascnd_client_create(&config);
+    CHECK(client == NULL);
+    CHECK(strstr(ascnd_last_error(), "tls_client_key_pem") != NULL);
+
+    ascnd_client_destroy(NULL);
+}
+
+/* A caller built against an older header passes a shorter struct */
+static void test_older_config(void) {
+    ascnd_config config;
+    size_t old_size = offsetof(ascnd_config, tls_session_resumption);
+
+    memset(&config, 0x5a, sizeof(config));
+    memset(&config, 0, old_size);
+    config.struct_size = old_size;
+    ascnd_config_defaults(&config);
+
+    CHECK(config.use_ssl == 1);
+    CHECK(config.max_retries == 3);
+    CHECK(((const unsigned char*)&config)[old_size] == 0x5a);
+    CHECK(((const unsigned char*)&config)[sizeof(config) - 1] == 0x5a);
+}
+
+static void test_requests(const char* address) {
+    ascnd_config config;
+    ascnd_client* client;
+    ascnd_submission submission;
+    ascnd_submission missing;
+    ascnd_leaderboard_query query;
+    ascnd_player_rank_query rank_query;
+    submit_outcome submitted = {0};
+    submit_outcome failed = {0};
+    leaderboard_outcome page = {0};
+    rank_outcome rank = {0};
+
+    ascnd_config_init(&config);
+    config.server_address = address;
+    config.api_key = "test-key";
+    config.use_ssl = 0;
+    config.max_retries = 0;
+    client = ascnd_client_create(&config);
+    CHECK(client != NULL);
+    if (!client) {
+        return;
+    }
+
+    memset(&submission, 0, sizeof(submission));
+    submission.leaderboard_id = "leaderboard";
+    submission.player_id = "player";
+    submission.score = 500;
+    CHECK(ascnd_submit_score(client, &submission, on_submit, &submitted) == 0);
+
+    missing = submission;
+    missing.leaderboard_id = "missing";
+    CHECK(ascnd_submit_score(client, &missing, on_submit, &failed) == 0);
+
+    memset(&query, 0, sizeof(query));
+    query.leaderboard_id = "leaderboard";
+    query.limit = 5;
+    query.view_slug = "warriors";
+    CHECK(ascnd_get_leaderboard(client, &query, on_leaderboard, &page) == 0);
+
+    memset(&rank_query, 0, sizeof(rank_query));
+    rank_query.leaderboard_id = "leaderboard";
+    rank_query.player_id = "player";
+    rank_query.view_slug = "warriors";
+    CHECK(ascnd_get_player_rank(client, &rank_query, on_rank, &rank) == 0);
+
+    /* Rejected before a request is started */
+    CHECK(ascnd_submit_score(client, &submission, NULL, NULL) == -1);
+    CHECK(strlen(ascnd_last_error()) > 0);
+    query.leaderboard_id = NULL;
+    CHECK(ascnd_get_leaderboard(client, &query, on_leaderboard, &page) == -1);
+
+    /* Waits for every callback */
+    ascnd_client_destroy(client);
+
+    CHECK(submitted.called && submitted.ok);
+    CHECK(submitted.score_id_ok);
+    CHECK(submitted.is_new_best == 1);
+    CHECK(submitted.violation_count == 0);
+
+    CHECK(failed.called && !failed.ok);
+    CHECK(failed.error_code == 5); /* NOT_FOUND */
+
+    CHECK(page.called && page.ok);
+    CHECK(page.entry_count == 5);
+    CHECK(page.bracket_count == 2);
+    CHECK(page.first_player_ok);
+    CHECK(page.first_score == 1000);
+    CHECK(page.third_bracket_gold);
+    CHECK(page.fourth_bracket_silver);
+    CHECK(page.view_ok);
+
+    CHECK(rank.called && rank.ok);
+    CHECK(rank.has_rank && rank.rank == 1);
+    CHECK(rank.has_global_rank && rank.global_rank == 7);
+}
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        fprintf(stderr, "usage: %s <server-address>\n", argv[0]);
+        return 2;
+    }
+
+    test_config(argv[1]);
+    test_older_config();
+    test_requests(argv[1]);
+
+    if (failures > 0) {
+        fprintf(stderr, "%d check(s) failed\n", failures);
+        return 1;
+    }
+    printf("All C API checks passed\n");
+    return 0;
+}
@@ -0,0 +1,185 @@
+/**
+ * @file flat_test.cpp
+ * @brief Tests for the plain value API
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+namespace ascnd {
+namespace {
+
+TEST(FlatIdTest, ShortIdsAreStoredInline) {
+    const std::string uuid = "123e4567-e89b-12d3-a456-426614174000";
+    flat::Id id(uuid);
+
+    EXPECT_EQ(id.view(), uuid);
+    EXPECT_EQ(id.size(), uuid.size());
+    const char* data = id.data();
+    const char* object = reinterpret_cast<const char*>(&id);
+    EXPECT_TRUE(data >= object && data < object + sizeof(id));
+}
+
+TEST(FlatIdTest, LongIdsSurviveCopyAndMove) {
+    const std::string text(100, 'x');
+    flat::Id id(text);
+    flat::Id copy = id;
+    flat::Id moved = std::move(id);
+
+    EXPECT_EQ(copy.view(), text);
+    EXPECT_EQ(moved.view(), text);
+    EXPECT_TRUE(id.empty());  // NOLINT(bugprone-use-after-move)
+    EXPECT_STREQ(id.c_str(), "");
+
+    copy = "short";
+    EXPECT_EQ(copy.str(), "short");
+    moved = copy;
+    EXPECT_EQ(moved, copy);
+}
+
+TEST(FlatIdTest, ComparesAndHashesByContent) {
+    flat::Id a("alpha");
+    flat::Id b(std::string("beta"));
+
+    EXPECT_LT(a, b);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a, flat::Id("alpha"));
+
+    std::unordered_set<flat::Id> ids{a, b, flat::Id("alpha")};
+    EXPECT_EQ(ids.size(), 2u);
+}
+
+class FlatClientTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+    }
+};
+
+TEST_F(FlatClientTest, SubmitScore) {
+    service.anticheat_violations = 2;
+    AscndClient client(config);
+
+    flat::ScoreSubmission submission;
+    submission.leaderboard_id = "leaderboard";
+    submission.player_id = "player";
+    submission.score = 500;
+    auto result = client.submit_score(submission);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().score_id, "score-1");
+    EXPECT_TRUE(result.value().is_new_best);
+    ASSERT_TRUE(result.value().anticheat.has_value());
+    EXPECT_FALSE(result.value().anticheat->passed);
+    EXPECT_EQ(result.value().anticheat->action, "flag");
+    ASSERT_EQ(result.value().anticheat->violations.size(), 2u);
+    EXPECT_EQ(result.value().anticheat->violations[1].flag_type, "score_velocity_1");
+}
+
+TEST_F(FlatClientTest, LeaderboardEntriesReferenceBrackets) {
+    AscndClient client(config);
+
+    flat::LeaderboardQuery query;
+    query.leaderboard_id = "leaderboard";
+    query.limit = 5;
+    query.view_slug = "warriors";
+    auto result = client.get_leaderboard(query);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    const flat::Leaderboard& page = result.value();
+    ASSERT_EQ(page.entries.size(), 5u);
+    ASSERT_EQ(page.brackets.size(), 2u);
+    EXPECT_EQ(page.total_entries, 5);
+    EXPECT_EQ(page.period_start, "2024-01-01T00:00:00Z");
+    ASSERT_TRUE(page.view.has_value());
+    EXPECT_EQ(page.view->name, "View warriors");
+
+    EXPECT_EQ(page.entries[0].player_id, flat::Id("player-1"));
+    EXPECT_EQ(page.entries[0].score, 1000);
+    ASSERT_NE(page.bracket_of(page.entries[2]), nullptr);
+    EXPECT_EQ(page.bracket_of(page.entries[2])->name, "Gold");
+    EXPECT_EQ(page.bracket_of(page.entries[3])->color, "#C0C0C0");
+}
+
+TEST_F(FlatClientTest, EntriesCanBeSortedInPlace) {
+    AscndClient client(config);
+
+    flat::LeaderboardQuery query;
+    query.leaderboard_id = "leaderboard";
+    auto result = client.get_leaderboard(query);
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    auto entries = std::move(result).value().entries;
+
+    std::sort(entries.begin(), entries.end(), [](const auto& a, const auto& b) {
+        return a.score < b.score;
+    });
+    EXPECT_EQ(entries.front().player_id.view(), "player-10");
+    EXPECT_EQ(entries.back().rank, 1);
+}
+
+TEST_F(FlatClientTest, PlayerRank) {
+    service.set_player_rank("leaderboard", "player", 7);
+    AscndClient client(config);
+
+    flat::PlayerRankQuery query;
+    query.leaderboard_id = "leaderboard";
+    query.player_id = "player";
+    query.view_slug = "warriors";
+    auto result = client.get_player_rank(query);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().rank, 1);
+    EXPECT_EQ(result.value().global_rank, 7);
+    EXPECT_EQ(result.value().global_total_entries, 1);
+    ASSERT_TRUE(result.value().view.has_value());
+    EXPECT_EQ(result.value().view->slug, "warriors");
+}
+
+TEST_F(FlatClientTest, ErrorsArePassedThrough) {
+    AscndClient client(config);
+
+    flat::ScoreSubmission submission;
+    submission.leaderboard_id = "missing";
+    submission.player_id = "player";
+    auto result = client.submit_score(submission);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error_code(), static_cast<int>(grpc::StatusCode::NOT_FOUND));
+}
+
+TEST_F(FlatClientTest, CallbackAsync) {
+    AscndClient client(config);
+
+    flat::LeaderboardQuery query;
+    query.leaderboard_id = "leaderboard";
+    query.limit = 3;
+    std::promise<Result<flat::Leaderboard>> promise;
+    client.get_leaderboard_async(query, [&promise](Result<flat::Leaderboard> result) {
+        promise.set_value(std::move(result));
+    });
+    auto result = promise.get_future().get();
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().entries.size(), 3u);
+}
+
+}  // namespace
+}  // namespace ascnd
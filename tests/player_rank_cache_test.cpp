@@ -0,0 +1,177 @@
+/**
+ * @file player_rank_cache_test.cpp
+ * @brief Tests for reusing player rank responses across views
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace ascnd {
+namespace {
+
+class PlayerRankCacheTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+        config.player_rank_cache_ms = 60000;
+
+        service.set_player_rank("leaderboard", "player", 7);
+    }
+
+    static GetPlayerRankRequest rank_request(const std::string& view_slug = "") {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player");
+        if (!view_slug.empty()) {
+            request.set_view_slug(view_slug);
+        }
+        return request;
+    }
+};
+
+TEST_F(PlayerRankCacheTest, OffByDefault) {
+    config.player_rank_cache_ms = 0;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+TEST_F(PlayerRankCacheTest, ReusesIdenticalRequests) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request("warriors")).is_ok());
+    auto reused = client.get_player_rank(rank_request("warriors"));
+
+    ASSERT_TRUE(reused.is_ok()) << reused.error();
+    EXPECT_EQ(reused.value().view().slug(), "warriors");
+    EXPECT_EQ(service.rank_calls.load(), 1);
+    EXPECT_EQ(client.stats().player_rank_cache_hits, 1u);
+}
+
+// A view response carries the global position, so the global query is free
+TEST_F(PlayerRankCacheTest, ViewResponseAnswersGlobalRequest) {
+    AscndClient client(config);
+
+    auto view = client.get_player_rank(rank_request("warriors"));
+    auto global = client.get_player_rank(rank_request());
+
+    ASSERT_TRUE(view.is_ok()) << view.error();
+    ASSERT_TRUE(global.is_ok()) << global.error();
+    EXPECT_EQ(view.value().rank(), 1);
+    EXPECT_EQ(global.value().rank(), 7);
+    EXPECT_EQ(global.value().best_score(), 1000);
+    EXPECT_FALSE(global.value().has_view());
+    EXPECT_FALSE(global.value().has_global_rank());
+    EXPECT_EQ(service.rank_calls.load(), 1);
+}
+
+TEST_F(PlayerRankCacheTest, GlobalResponseDoesNotAnswerViewRequest) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+    ASSERT_TRUE(client.get_player_rank(rank_request("warriors")).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+TEST_F(PlayerRankCacheTest, OtherPeriodsAreNotReused) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request("warriors")).is_ok());
+    auto previous = rank_request();
+    previous.set_period("previous");
+    ASSERT_TRUE(client.get_player_rank(previous).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+TEST_F(PlayerRankCacheTest, SubmissionsInvalidateRanks) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 2000).is_ok());
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+// A lookup answered before a submission is not cached after it
+TEST_F(PlayerRankCacheTest, LookupInFlightDuringSubmissionIsNotStored) {
+    service.read_delay_ms = 200;
+    AscndClient client(config);
+
+    auto lookup = client.get_player_rank_async(rank_request());
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 2000).is_ok());
+    ASSERT_TRUE(lookup.get().is_ok());
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+    EXPECT_EQ(client.stats().player_rank_cache_hits, 0u);
+}
+
+TEST_F(PlayerRankCacheTest, BatchSubmissionsInvalidateRanks) {
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+    SubmitScoreBatchRequest batch;
+    auto* submission = batch.add_submissions();
+    submission->set_leaderboard_id("leaderboard");
+    submission->set_player_id("player");
+    submission->set_score(2000);
+    ASSERT_TRUE(client.submit_score_batch(batch).is_ok());
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+TEST_F(PlayerRankCacheTest, ResponsesExpire) {
+    config.player_rank_cache_ms = 1;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(client.get_player_rank(rank_request()).is_ok());
+
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+TEST_F(PlayerRankCacheTest, RemembersViewInfo) {
+    config.player_rank_cache_ms = 0;
+    AscndClient client(config);
+    EXPECT_FALSE(client.cached_view("leaderboard", "warriors").has_value());
+
+    ASSERT_TRUE(client.get_player_rank(rank_request("warriors")).is_ok());
+    GetLeaderboardRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_view_slug("mages");
+    ASSERT_TRUE(client.get_leaderboard(request).is_ok());
+
+    auto warriors = client.cached_view("leaderboard", "warriors");
+    ASSERT_TRUE(warriors.has_value());
+    EXPECT_EQ(warriors->name(), "View warriors");
+    EXPECT_TRUE(client.cached_view("leaderboard", "mages").has_value());
+    EXPECT_FALSE(client.cached_view("other-leaderboard", "mages").has_value());
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,346 @@
+/**
+ * @file proxy_test.cpp
+ * @brief Tests for the local aggregation proxy against a stand-in upstream
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "proxy_server.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+class ProxyTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService upstream_service;
+    std::unique_ptr<testing::FakeServer> upstream;
+    proxy::ProxyOptions options;
+
+    std::unique_ptr<proxy::ProxyService> proxy_service;
+    std::unique_ptr<testing::FakeServer> proxy_server;
+
+    void SetUp() override {
+        upstream = std::make_unique<testing::FakeServer>(&upstream_service);
+        ASSERT_NE(upstream->port(), 0);
+
+        options.upstream_address = upstream->address();
+        options.upstream_use_ssl = false;
+        options.request_timeout_ms = 5000;
+    }
+
+    void TearDown() override {
+        // The proxy server must stop before its service is destroyed
+        proxy_server.reset();
+        proxy_service.reset();
+    }
+
+    void start_proxy() {
+        proxy_service = std::make_unique<proxy::ProxyService>(options);
+        proxy_server = std::make_unique<testing::FakeServer>(proxy_service.get());
+        ASSERT_NE(proxy_server->port(), 0);
+    }
+
+    ClientConfig client_config(const std::string& api_key = "test-key") {
+        ClientConfig config;
+        config.server_address = proxy_server->address();
+        config.api_key = api_key;
+        config.use_ssl = false;
+        config.request_timeout_ms = 5000;
+        config.max_retries = 0;
+        return config;
+    }
+
+    // One client per simulated game server process
+    std::vector<std::unique_ptr<AscndClient>> make_clients(int count) {
+        std::vector<std::unique_ptr<AscndClient>> clients;
+        for (int i = 0; i < count; ++i) {
+            clients.push_back(std::make_unique<AscndClient>(client_config()));
+        }
+        return clients;
+    }
+};
+
+// Invalid options are rejected at construction
+TEST_F(ProxyTest, InvalidOptionsThrow) {
+    options.upstream_address.clear();
+    EXPECT_THROW(proxy::ProxyService service(options), std::invalid_argument);
+
+    options.upstream_address = "localhost:1";
+    options.upstream_channels = 0;
+    EXPECT_THROW(proxy::ProxyService service(options), std::invalid_argument);
+
+    options.upstream_channels = 1;
+    options.tls_client_cert_pem = "cert";
+    EXPECT_THROW(proxy::ProxyService service(options), std::invalid_argument);
+
+    options.tls_client_cert_pem.clear();
+    options.tls_root_certs_pem = "roots";
+    options.upstream_use_ssl = false;
+    EXPECT_THROW(proxy::ProxyService service(options), std::invalid_argument);
+}
+
+// A single submission is forwarded upstream and its response returned
+TEST_F(ProxyTest, ForwardsSubmission) {
+    start_proxy();
+    AscndClient client(client_config());
+
+    auto result = client.submit_score("leaderboard", "player", 100);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().rank(), 1);
+    EXPECT_EQ(upstream_service.submit_calls.load() + upstream_service.batch_calls.load(), 1);
+}
+
+// Concurrent submissions within the batch window share upstream calls
+TEST_F(ProxyTest, BatchesConcurrentSubmissions) {
+    options.batch_window_ms = 100;
+    start_proxy();
+
+    constexpr int kSubmissions = 20;
+    auto clients = make_clients(kSubmissions);
+    std::vector<std::future<Result<SubmitScoreResponse>>> futures;
+    for (int i = 0; i < kSubmissions; ++i) {
+        SubmitScoreRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player-" + std::to_string(i));
+        request.set_score(i + 1);
+        futures.push_back(clients[i]->submit_score_async(request));
+    }
+    for (int i = 0; i < kSubmissions; ++i) {
+        auto result = futures[i].get();
+        ASSERT_TRUE(result.is_ok()) << result.error();
+        EXPECT_EQ(result.value().score_id(), "batch-score-player-" + std::to_string(i));
+    }
+
+    auto stats = proxy_service->stats();
+    EXPECT_EQ(stats.downstream_requests, static_cast<uint64_t>(kSubmissions));
+    EXPECT_LT(stats.upstream_requests, static_cast<uint64_t>(kSubmissions));
+    EXPECT_GT(upstream_service.batch_calls.load(), 0);
+}
+
+// Per-submission errors inside a batch reach the right caller
+TEST_F(ProxyTest, BatchPropagatesPerSubmissionErrors) {
+    options.batch_window_ms = 100;
+    start_proxy();
+    auto clients = make_clients(2);
+
+    SubmitScoreRequest good;
+    good.set_leaderboard_id("leaderboard");
+    good.set_player_id("good");
+    good.set_score(10);
+    SubmitScoreRequest bad = good;
+    bad.set_player_id("bad");
+    bad.set_score(-1);
+
+    auto good_future = clients[0]->submit_score_async(good);
+    auto bad_future = clients[1]->submit_score_async(bad);
+
+    EXPECT_TRUE(good_future.get().is_ok());
+    auto bad_result = bad_future.get();
+    ASSERT_TRUE(bad_result.is_error());
+    EXPECT_EQ(bad_result.error_code(), static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+}
+
+// Upstreams without SubmitScoreBatch fall back to individual submissions
+TEST_F(ProxyTest, FallsBackWhenBatchUnsupported) {
+    upstream_service.batch_supported = false;
+    options.batch_window_ms = 100;
+    start_proxy();
+    auto clients = make_clients(4);
+
+    std::vector<std::future<Result<SubmitScoreResponse>>> futures;
+    for (int i = 0; i < 4; ++i) {
+        futures.push_back(clients[i]->submit_score_async(
+            [i]() {
+                SubmitScoreRequest request;
+                request.set_leaderboard_id("leaderboard");
+                request.set_player_id("player-" + std::to_string(i));
+                request.set_score(i + 1);
+                return request;
+            }()));
+    }
+    for (auto& future : futures) {
+        EXPECT_TRUE(future.get().is_ok());
+    }
+    EXPECT_EQ(upstream_service.submit_calls.load(), 4);
+}
+
+// Identical concurrent reads are answered by one upstream call
+TEST_F(ProxyTest, CoalescesIdenticalReads) {
+    upstream_service.read_delay_ms = 200;
+    start_proxy();
+
+    constexpr int kReaders = 8;
+    auto clients = make_clients(kReaders);
+    GetLeaderboardRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_limit(3);
+
+    std::vector<std::future<Result<GetLeaderboardResponse>>> futures;
+    for (int i = 0; i < kReaders; ++i) {
+        futures.push_back(clients[i]->get_leaderboard_async(request));
+    }
+    for (auto& future : futures) {
+        auto result = future.get();
+        ASSERT_TRUE(result.is_ok()) << result.error();
+        EXPECT_EQ(result.value().entries_size(), 3);
+    }
+
+    EXPECT_LT(upstream_service.leaderboard_calls.load(), kReaders);
+    EXPECT_GT(proxy_service->stats().coalesced_reads, 0u);
+}
+
+// Different reads are never coalesced
+TEST_F(ProxyTest, DoesNotCoalesceDifferentReads) {
+    upstream_service.read_delay_ms = 100;
+    start_proxy();
+    auto clients = make_clients(2);
+
+    auto first = clients[0]->get_player_rank_async([]() {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("alice");
+        return request;
+    }());
+    auto second = clients[1]->get_player_rank_async([]() {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("bob");
+        return request;
+    }());
+
+    EXPECT_TRUE(first.get().is_ok());
+    EXPECT_TRUE(second.get().is_ok());
+    EXPECT_EQ(upstream_service.rank_calls.load(), 2);
+    EXPECT_EQ(proxy_service->stats().coalesced_reads, 0u);
+}
+
+// Downstream authorization is forwarded upstream
+TEST_F(ProxyTest, ForwardsAuthorization) {
+    start_proxy();
+    AscndClient client(client_config("downstream-key"));
+
+    ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+
+    EXPECT_EQ(upstream_service.last_authorization(), "Bearer downstream-key");
+}
+
+// The proxy's own key is used when a request carries none
+TEST_F(ProxyTest, UsesProxyKeyWithoutDownstreamAuthorization) {
+    options.api_key = "proxy-key";
+    start_proxy();
+    AscndClient client(client_config(""));
+
+    ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+
+    EXPECT_EQ(upstream_service.last_authorization(), "Bearer proxy-key");
+}
+
+// With a zero batch window submissions are forwarded one by one
+TEST_F(ProxyTest, ZeroWindowForwardsImmediately) {
+    options.batch_window_ms = 0;
+    start_proxy();
+    AscndClient client(client_config());
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+
+    EXPECT_EQ(upstream_service.submit_calls.load(), 1);
+    EXPECT_EQ(upstream_service.batch_calls.load(), 0);
+}
+
+// Client batches pass through the proxy unchanged
+TEST_F(ProxyTest, ForwardsClientBatches) {
+    start_proxy();
+    AscndClient client(client_config());
+
+    SubmitScoreBatchRequest request;
+    for (int i = 0; i < 3; ++i) {
+        auto* submission = request.add_submissions();
+        submission->set_leaderboard_id("leaderboard");
+        submission->set_player_id("player-" + std::to_string(i));
+        submission->set_score(i + 1);
+    }
+
+    auto result = client.submit_score_batch(request);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().results_size(), 3);
+    EXPECT_EQ(upstream_service.batch_calls.load(), 1);
+}
+
+// A downstream deadline sooner than the proxy's timeout is kept upstream by
+// reads that are not shared
+TEST_F(ProxyTest, PropagatesDownstreamDeadline) {
+    options.request_timeout_ms = 60000;
+    options.coalesce_reads = false;
+    start_proxy();
+    ClientConfig config = client_config();
+    config.request_timeout_ms = 2000;
+    AscndClient client(config);
+
+    auto sent = std::chrono::system_clock::now();
+    ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+
+    EXPECT_LE(upstream_service.last_deadline(), sent + std::chrono::seconds(3));
+}
+
+// A shared read is not cut short by the deadline of the caller that started it
+TEST_F(ProxyTest, CoalescedReadsKeepTheirOwnDeadlines) {
+    upstream_service.read_delay_ms = 300;
+    start_proxy();
+    ClientConfig impatient_config = client_config();
+    impatient_config.request_timeout_ms = 100;
+    AscndClient impatient(impatient_config);
+    AscndClient patient(client_config());
+
+    GetLeaderboardRequest request;
+    request.set_leaderboard_id("leaderboard");
+    auto first = impatient.get_leaderboard_async(request);
+    std::this_thread::sleep_for(std::chrono::milliseconds(30));
+    auto second = patient.get_leaderboard_async(request);
+
+    auto timed_out = first.get();
+    ASSERT_TRUE(timed_out.is_error());
+    EXPECT_EQ(timed_out.error_code(), static_cast<int>(grpc::StatusCode::DEADLINE_EXCEEDED));
+    auto result = second.get();
+    EXPECT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(upstream_service.leaderboard_calls.load(), 1);
+    EXPECT_EQ(proxy_service->stats().coalesced_reads, 1u);
+}
+
+// Batched rank lookups and rules requests are forwarded too
+TEST_F(ProxyTest, ForwardsRanksAndRules) {
+    start_proxy();
+    ClientConfig config = client_config();
+    config.player_rank_batch_window_ms = 200;
+    AscndClient client(config);
+
+    GetPlayerRankRequest alice;
+    alice.set_leaderboard_id("leaderboard");
+    alice.set_player_id("alice");
+    GetPlayerRankRequest bob = alice;
+    bob.set_player_id("bob");
+    auto first = client.get_player_rank_async(alice);
+    auto second = client.get_player_rank_async(bob);
+    EXPECT_TRUE(first.get().is_ok());
+    EXPECT_TRUE(second.get().is_ok());
+    EXPECT_EQ(upstream_service.ranks_batch_calls.load(), 1);
+
+    GetLeaderboardRulesRequest rules;
+    rules.set_leaderboard_id("leaderboard");
+    auto result = client.get_leaderboard_rules(rules);
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().leaderboard_id(), "leaderboard");
+    EXPECT_EQ(upstream_service.rules_calls.load(), 1);
+}
+
+}  // namespace
+}  // namespace ascnd
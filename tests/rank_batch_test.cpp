@@ -0,0 +1,224 @@
+/**
+ * @file rank_batch_test.cpp
+ * @brief Tests for coalescing get_player_rank calls into GetPlayerRanks
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+class RankBatchTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+        config.player_rank_batch_window_ms = 200;
+
+        for (int i = 0; i < 5; ++i) {
+            service.set_player_rank("leaderboard", player(i), 10 + i);
+        }
+    }
+
+    static std::string player(int i) { return "player-" + std::to_string(i); }
+
+    static GetPlayerRankRequest rank_request(const std::string& player_id,
+                                             const std::string& view_slug = "") {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id(player_id);
+        if (!view_slug.empty()) {
+            request.set_view_slug(view_slug);
+        }
+        return request;
+    }
+
+    // Issue all requests at once from separate threads
+    static std::vector<Result<GetPlayerRankResponse>> concurrently(
+        AscndClient& client, const std::vector<GetPlayerRankRequest>& requests) {
+        std::vector<std::future<Result<GetPlayerRankResponse>>> futures;
+        for (const auto& request : requests) {
+            futures.push_back(client.get_player_rank_async(request));
+        }
+        std::vector<Result<GetPlayerRankResponse>> results;
+        for (auto& future : futures) {
+            results.push_back(future.get());
+        }
+        return results;
+    }
+};
+
+TEST_F(RankBatchTest, OffByDefault) {
+    config.player_rank_batch_window_ms = 0;
+    AscndClient client(config);
+
+    auto results = concurrently(client, {rank_request(player(0)), rank_request(player(1))});
+
+    for (const auto& result : results) {
+        EXPECT_TRUE(result.is_ok()) << result.error();
+    }
+    EXPECT_EQ(service.rank_calls.load(), 2);
+    EXPECT_EQ(service.ranks_batch_calls.load(), 0);
+}
+
+TEST_F(RankBatchTest, CoalescesConcurrentLookups) {
+    AscndClient client(config);
+
+    std::vector<GetPlayerRankRequest> requests;
+    for (int i = 0; i < 5; ++i) {
+        requests.push_back(rank_request(player(i)));
+    }
+    auto results = concurrently(client, requests);
+
+    for (int i = 0; i < 5; ++i) {
+        ASSERT_TRUE(results[i].is_ok()) << results[i].error();
+        EXPECT_EQ(results[i].value().rank(), 10 + i);
+    }
+    EXPECT_EQ(service.ranks_batch_calls.load(), 1);
+    EXPECT_EQ(service.rank_calls.load(), 0);
+
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.player_rank_batches, 1u);
+    EXPECT_EQ(stats.player_ranks_batched, 5u);
+    EXPECT_EQ(stats.rank_batch_sizes.total(), 1u);
+    EXPECT_EQ(stats.rank_batch_sizes.counts[2], 1u);    // 4 to 7 lookups
+    EXPECT_EQ(stats.rank_batch_windows.counts[9], 1u);  // 128 to 256 ms
+}
+
+TEST_F(RankBatchTest, FansOutToCallbacks) {
+    AscndClient client(config);
+
+    std::vector<std::promise<int>> ranks(3);
+    for (int i = 0; i < 3; ++i) {
+        client.get_player_rank_async(rank_request(player(i)), [&ranks, i](Result<GetPlayerRankResponse> result) {
+            ranks[i].set_value(result.is_ok() ? result.value().rank() : -1);
+        });
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        EXPECT_EQ(ranks[i].get_future().get(), 10 + i);
+    }
+    EXPECT_EQ(service.ranks_batch_calls.load(), 1);
+}
+
+TEST_F(RankBatchTest, SingleLookupIsSentAlone) {
+    config.player_rank_batch_window_ms = 5;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank(rank_request(player(2)));
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().rank(), 12);
+    EXPECT_EQ(service.rank_calls.load(), 1);
+    EXPECT_EQ(service.ranks_batch_calls.load(), 0);
+}
+
+TEST_F(RankBatchTest, ViewsAreBatchedSeparately) {
+    AscndClient client(config);
+
+    auto results = concurrently(client, {rank_request(player(0)), rank_request(player(1)),
+                                         rank_request(player(0), "warriors"),
+                                         rank_request(player(1), "warriors")});
+
+    for (const auto& result : results) {
+        EXPECT_TRUE(result.is_ok()) << result.error();
+    }
+    EXPECT_FALSE(results[0].value().has_view());
+    EXPECT_EQ(results[2].value().view().slug(), "warriors");
+    EXPECT_EQ(service.ranks_batch_calls.load(), 2);
+}
+
+TEST_F(RankBatchTest, ErrorsAreReportedPerPlayer) {
+    AscndClient client(config);
+
+    auto results = concurrently(client, {rank_request(player(0)), rank_request("missing"),
+                                         rank_request(player(1))});
+
+    EXPECT_TRUE(results[0].is_ok());
+    ASSERT_TRUE(results[1].is_error());
+    EXPECT_EQ(results[1].error_code(), static_cast<int>(grpc::StatusCode::NOT_FOUND));
+    EXPECT_EQ(results[1].error(), "player not found");
+    EXPECT_TRUE(results[2].is_ok());
+}
+
+TEST_F(RankBatchTest, FallsBackWhenUnsupported) {
+    service.ranks_batch_supported = false;
+    AscndClient client(config);
+
+    auto results = concurrently(client, {rank_request(player(0)), rank_request(player(1)),
+                                         rank_request(player(2))});
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(results[i].is_ok()) << results[i].error();
+        EXPECT_EQ(results[i].value().rank(), 10 + i);
+    }
+    EXPECT_EQ(service.rank_calls.load(), 3);
+
+    // Later lookups skip the batching window altogether
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_TRUE(client.get_player_rank(rank_request(player(3))).is_ok());
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(150));
+    EXPECT_EQ(service.rank_calls.load(), 4);
+}
+
+TEST_F(RankBatchTest, AdaptiveWindowSendsIdleLookupsAtOnce) {
+    config.player_rank_batch_window_ms = 1000;
+    config.adaptive_batching = true;
+    AscndClient client(config);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(client.get_player_rank(rank_request(player(i))).is_ok());
+    }
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(900));
+    EXPECT_EQ(service.rank_calls.load(), 3);
+
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.rank_batch_windows.counts[0], 3u);
+    EXPECT_EQ(stats.rank_batch_sizes.counts[0], 3u);
+}
+
+TEST_F(RankBatchTest, AdaptiveWindowBatchesBursts) {
+    config.player_rank_batch_window_ms = 1000;
+    config.adaptive_batching = true;
+    service.read_delay_ms = 20;
+    AscndClient client(config);
+
+    std::vector<GetPlayerRankRequest> requests;
+    for (int i = 0; i < 20; ++i) {
+        requests.push_back(rank_request(player(i % 5)));
+    }
+    auto results = concurrently(client, requests);
+
+    for (int i = 0; i < 20; ++i) {
+        ASSERT_TRUE(results[i].is_ok()) << results[i].error();
+        EXPECT_EQ(results[i].value().rank(), 10 + i % 5);
+    }
+    EXPECT_GE(service.ranks_batch_calls.load(), 1);
+    EXPECT_LT(service.rank_calls.load(), 20);
+
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.rank_batch_sizes.total(),
+              static_cast<uint64_t>(service.rank_calls.load() + service.ranks_batch_calls.load()));
+    EXPECT_EQ(stats.rank_batch_windows.total(), stats.rank_batch_sizes.total());
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,188 @@
+/**
+ * @file rank_watcher_test.cpp
+ * @brief Tests for the WatchPlayerRanks client against a stand-in server
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+// Collects events delivered on the watcher's callback thread
+struct EventCollector {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::vector<RankChangeEvent> events;
+
+    RankChangeCallback callback() {
+        return [this](const RankChangeEvent& event) {
+            std::lock_guard<std::mutex> lock(mutex);
+            events.push_back(event);
+            cv.notify_all();
+        };
+    }
+
+    // Waits until at least count events arrived; returns the events so far
+    std::vector<RankChangeEvent> wait_for(size_t count,
+                                          std::chrono::milliseconds timeout = std::chrono::seconds(5)) {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait_for(lock, timeout, [&]() { return events.size() >= count; });
+        return events;
+    }
+};
+
+class RankWatcherTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    std::unique_ptr<AscndClient> client;
+    EventCollector collector;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        ClientConfig config;
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+        client = std::make_unique<AscndClient>(config);
+    }
+};
+
+// Newly watched players report their current rank without a previous rank
+TEST_F(RankWatcherTest, WatchDeliversCurrentRanks) {
+    auto watcher = client->watch_player_ranks(collector.callback());
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice", "bob"}));
+
+    auto events = collector.wait_for(2);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[0].player_id(), "alice");
+    EXPECT_EQ(events[0].rank(), 1);
+    EXPECT_FALSE(events[0].has_previous_rank());
+    EXPECT_EQ(events[1].player_id(), "bob");
+    EXPECT_EQ(watcher->watched_count(), 2u);
+    EXPECT_EQ(service.last_authorization(), "Bearer test-key");
+}
+
+TEST_F(RankWatcherTest, RankChangesArePushed) {
+    auto watcher = client->watch_player_ranks(collector.callback());
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));
+    ASSERT_EQ(collector.wait_for(1).size(), 1u);
+
+    service.set_player_rank("leaderboard", "alice", 4);
+
+    auto events = collector.wait_for(2);
+    ASSERT_EQ(events.size(), 2u);
+    EXPECT_EQ(events[1].previous_rank(), 1);
+    EXPECT_EQ(events[1].rank(), 4);
+}
+
+// Players on several leaderboards share one stream
+TEST_F(RankWatcherTest, OneStreamForAllPlayers) {
+    auto watcher = client->watch_player_ranks(collector.callback());
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));
+    ASSERT_TRUE(watcher->watch("other-leaderboard", {"alice", "bob"}));
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));  // Already watched
+
+    EXPECT_EQ(collector.wait_for(3).size(), 3u);
+    EXPECT_EQ(watcher->watched_count(), 3u);
+    EXPECT_EQ(service.watch_calls.load(), 1);
+}
+
+TEST_F(RankWatcherTest, UnwatchStopsEvents) {
+    auto watcher = client->watch_player_ranks(collector.callback());
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice", "bob"}));
+    ASSERT_EQ(collector.wait_for(2).size(), 2u);
+
+    ASSERT_TRUE(watcher->unwatch("leaderboard", {"alice"}));
+    service.set_player_rank("leaderboard", "alice", 7);
+    service.set_player_rank("leaderboard", "bob", 3);
+
+    auto events = collector.wait_for(3);
+    ASSERT_EQ(events.size(), 3u);
+    EXPECT_EQ(events[2].player_id(), "bob");
+    EXPECT_EQ(watcher->watched_count(), 1u);
+    EXPECT_EQ(collector.wait_for(4, std::chrono::milliseconds(100)).size(), 3u);
+}
+
+// unwatch() waits for a callback that is already running for the player
+TEST_F(RankWatcherTest, UnwatchWaitsForRunningCallback) {
+    std::promise<void> current;
+    std::promise<void> entered;
+    std::atomic<bool> finished{false};
+    std::atomic<bool> unwatched{false};
+    std::atomic<int> late_callbacks{0};
+    auto watcher = client->watch_player_ranks([&](const RankChangeEvent& event) {
+        if (unwatched) {
+            ++late_callbacks;
+        }
+        if (event.has_previous_rank()) {
+            entered.set_value();
+            std::this_thread::sleep_for(std::chrono::milliseconds(200));
+            finished = true;
+        } else {
+            current.set_value();
+        }
+    });
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));
+    current.get_future().wait();
+
+    service.set_player_rank("leaderboard", "alice", 5);
+    entered.get_future().wait();
+    ASSERT_TRUE(watcher->unwatch("leaderboard", {"alice"}));
+    unwatched = true;
+
+    EXPECT_TRUE(finished.load());
+    service.set_player_rank("leaderboard", "alice", 6);
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+    EXPECT_EQ(late_callbacks.load(), 0);
+}
+
+// The callback may unwatch the player it is called for
+TEST_F(RankWatcherTest, UnwatchFromCallback) {
+    std::promise<bool> unwatched;
+    std::unique_ptr<RankWatcher> watcher;
+    watcher = client->watch_player_ranks([&](const RankChangeEvent& event) {
+        unwatched.set_value(watcher->unwatch(event.leaderboard_id(), {event.player_id()}));
+    });
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));
+
+    auto result = unwatched.get_future();
+    ASSERT_EQ(result.wait_for(std::chrono::seconds(5)), std::future_status::ready);
+    EXPECT_TRUE(result.get());
+    EXPECT_EQ(watcher->watched_count(), 0u);
+}
+
+TEST_F(RankWatcherTest, CloseEndsStream) {
+    auto watcher = client->watch_player_ranks(collector.callback());
+    ASSERT_TRUE(watcher->watch("leaderboard", {"alice"}));
+    ASSERT_EQ(collector.wait_for(1).size(), 1u);
+
+    auto closed = watcher->close();
+
+    ASSERT_TRUE(closed.is_ok()) << closed.error();
+    EXPECT_EQ(closed.value(), 1u);
+    EXPECT_FALSE(watcher->is_open());
+    EXPECT_FALSE(watcher->watch("leaderboard", {"bob"}));
+}
+
+TEST_F(RankWatcherTest, RequiresCallback) {
+    EXPECT_THROW(client->watch_player_ranks(nullptr), std::invalid_argument);
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,175 @@
+/**
+ * @file score_stream_test.cpp
+ * @brief Tests for the SubmitScoreStream client against a stand-in server
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace ascnd {
+namespace {
+
+// Collects acknowledgements delivered on the stream's callback thread
+struct AckCollector {
+    std::mutex mutex;
+    std::map<uint64_t, Result<SubmitScoreResponse>> results;
+
+    ScoreAckCallback callback() {
+        return [this](uint64_t sequence, Result<SubmitScoreResponse> result) {
+            std::lock_guard<std::mutex> lock(mutex);
+            results.emplace(sequence, std::move(result));
+        };
+    }
+
+    size_t size() {
+        std::lock_guard<std::mutex> lock(mutex);
+        return results.size();
+    }
+};
+
+SubmitScoreRequest MakeSubmission(const std::string& player_id, int64_t score) {
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id(player_id);
+    request.set_score(score);
+    return request;
+}
+
+class ScoreStreamTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    std::unique_ptr<AscndClient> client;
+    AckCollector acks;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        ClientConfig config;
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.request_timeout_ms = 2000;
+        config.max_retries = 0;
+        client = std::make_unique<AscndClient>(config);
+    }
+};
+
+// Every write is acknowledged once, all over a single RPC
+TEST_F(ScoreStreamTest, WritesShareOneCall) {
+    auto stream = client->open_score_stream(acks.callback());
+
+    for (int i = 0; i < 20; ++i) {
+        auto written = stream->write(MakeSubmission("player-" + std::to_string(i), 100 + i));
+        ASSERT_TRUE(written.is_ok()) << written.error();
+        EXPECT_EQ(written.value(), static_cast<uint64_t>(i + 1));
+    }
+
+    auto finished = stream->finish();
+    ASSERT_TRUE(finished.is_ok()) << finished.error();
+    EXPECT_EQ(finished.value(), 20u);
+    EXPECT_EQ(stream->in_flight(), 0u);
+
+    ASSERT_EQ(acks.size(), 20u);
+    EXPECT_EQ(acks.results.at(1).value().score_id(), "stream-score-player-0");
+    EXPECT_EQ(acks.results.at(20).value().score_id(), "stream-score-player-19");
+    EXPECT_EQ(service.stream_calls.load(), 1);
+    EXPECT_EQ(service.streamed_submissions.load(), 20);
+    EXPECT_EQ(service.submit_calls.load(), 0);
+    EXPECT_EQ(service.last_authorization(), "Bearer test-key");
+}
+
+// A rejected submission is reported without closing the stream
+TEST_F(ScoreStreamTest, PerSubmissionErrorsKeepStreamOpen) {
+    auto stream = client->open_score_stream(acks.callback());
+
+    ASSERT_TRUE(stream->write(MakeSubmission("bad", -1)).is_ok());
+    ASSERT_TRUE(stream->write(MakeSubmission("good", 10)).is_ok());
+    ASSERT_TRUE(stream->finish().is_ok());
+
+    ASSERT_EQ(acks.size(), 2u);
+    EXPECT_TRUE(acks.results.at(1).is_error());
+    EXPECT_EQ(acks.results.at(1).error_code(), static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+    EXPECT_TRUE(acks.results.at(2).is_ok());
+}
+
+TEST_F(ScoreStreamTest, TryWriteFailsWhenWindowIsFull) {
+    service.ack_delay_ms = 200;
+    ScoreStreamOptions options;
+    options.max_in_flight = 1;
+    auto stream = client->open_score_stream(acks.callback(), options);
+
+    ASSERT_TRUE(stream->try_write(MakeSubmission("first", 1)).is_ok());
+    auto rejected = stream->try_write(MakeSubmission("second", 2));
+    ASSERT_TRUE(rejected.is_error());
+    EXPECT_EQ(rejected.error_code(), static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+
+    // A blocking write waits for the first acknowledgement instead
+    auto written = stream->write(MakeSubmission("second", 2));
+    ASSERT_TRUE(written.is_ok()) << written.error();
+    EXPECT_EQ(written.value(), 2u);
+
+    auto finished = stream->finish();
+    ASSERT_TRUE(finished.is_ok()) << finished.error();
+    EXPECT_EQ(finished.value(), 2u);
+}
+
+TEST_F(ScoreStreamTest, WriteAfterFinishFails) {
+    auto stream = client->open_score_stream(acks.callback());
+    EXPECT_TRUE(stream->is_open());
+    ASSERT_TRUE(stream->finish().is_ok());
+
+    EXPECT_FALSE(stream->is_open());
+    auto written = stream->write(MakeSubmission("late", 1));
+    ASSERT_TRUE(written.is_error());
+    EXPECT_EQ(written.error_code(), static_cast<int>(grpc::StatusCode::FAILED_PRECONDITION));
+}
+
+// A broken stream fails what the server never acknowledged
+TEST_F(ScoreStreamTest, StreamFailureFailsOutstandingWrites) {
+    service.stream_fail_after = 3;
+    auto stream = client->open_score_stream(acks.callback());
+
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(stream->write(MakeSubmission("player", 10)).is_ok());
+    }
+    auto finished = stream->finish();
+
+    ASSERT_TRUE(finished.is_error());
+    EXPECT_EQ(finished.error_code(), static_cast<int>(grpc::StatusCode::UNAVAILABLE));
+    ASSERT_EQ(acks.size(), 3u);
+    EXPECT_TRUE(acks.results.at(1).is_ok());
+    EXPECT_TRUE(acks.results.at(2).is_ok());
+    EXPECT_EQ(acks.results.at(3).error_code(), static_cast<int>(grpc::StatusCode::UNAVAILABLE));
+}
+
+// Destroying an unfinished stream cancels it; every write still gets a callback
+TEST_F(ScoreStreamTest, DestroyingUnfinishedStreamCancels) {
+    service.ack_delay_ms = 200;
+    auto stream = client->open_score_stream(acks.callback());
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(stream->write(MakeSubmission("player", 10)).is_ok());
+    }
+
+    stream.reset();
+
+    ASSERT_EQ(acks.size(), 3u);
+    EXPECT_TRUE(acks.results.at(3).is_error());
+}
+
+TEST_F(ScoreStreamTest, RejectsInvalidOptions) {
+    ScoreStreamOptions options;
+    options.max_in_flight = 0;
+    EXPECT_THROW(client->open_score_stream(acks.callback(), options), std::invalid_argument);
+    EXPECT_THROW(client->open_score_stream(nullptr), std::invalid_argument);
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,152 @@
+/**
+ * @file session_test.cpp
+ * @brief Tests for session mode against a stand-in server
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+class SessionTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.request_timeout_ms = 2000;
+        config.max_retries = 0;
+        config.session_mode = true;
+    }
+};
+
+// All request types travel over a single Session call
+TEST_F(SessionTest, RequestsShareOneStream) {
+    AscndClient client(config);
+
+    for (int i = 0; i < 10; ++i) {
+        auto submitted = client.submit_score("leaderboard", "player-" + std::to_string(i), 100);
+        ASSERT_TRUE(submitted.is_ok()) << submitted.error();
+    }
+    auto leaderboard = client.get_leaderboard("leaderboard", 5);
+    auto rank = client.get_player_rank("leaderboard", "player-1");
+
+    ASSERT_TRUE(leaderboard.is_ok()) << leaderboard.error();
+    EXPECT_EQ(leaderboard.value().entries_size(), 5);
+    ASSERT_TRUE(rank.is_ok()) << rank.error();
+    EXPECT_EQ(rank.value().rank(), 1);
+
+    EXPECT_EQ(service.session_calls.load(), 1);
+    EXPECT_EQ(service.submit_calls.load(), 10);
+    EXPECT_EQ(service.last_authorization(), "Bearer test-key");
+}
+
+// A slow read does not hold up a later submission on the same stream
+TEST_F(SessionTest, ResponsesCompleteOutOfOrder) {
+    service.read_delay_ms = 300;
+    AscndClient client(config);
+
+    auto slow = std::async(std::launch::async, [&client]() {
+        return client.get_leaderboard("leaderboard", 3);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+    auto submitted = client.submit_score("leaderboard", "player", 100);
+    ASSERT_TRUE(submitted.is_ok()) << submitted.error();
+    EXPECT_EQ(slow.wait_for(std::chrono::seconds(0)), std::future_status::timeout);
+
+    auto leaderboard = slow.get();
+    ASSERT_TRUE(leaderboard.is_ok()) << leaderboard.error();
+    EXPECT_EQ(service.session_calls.load(), 1);
+}
+
+TEST_F(SessionTest, ConcurrentRequestsArePipelined) {
+    service.read_delay_ms = 200;
+    AscndClient client(config);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<Result<GetPlayerRankResponse>>> ranks;
+    for (int i = 0; i < 8; ++i) {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player-" + std::to_string(i));
+        ranks.push_back(client.get_player_rank_async(request));
+    }
+    for (auto& rank : ranks) {
+        ASSERT_TRUE(rank.get().is_ok());
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    // Serialized, eight reads would take at least 1.6s
+    EXPECT_LT(elapsed, std::chrono::milliseconds(1200));
+    EXPECT_EQ(service.session_calls.load(), 1);
+}
+
+// Per-request errors are reported without ending the stream
+TEST_F(SessionTest, RequestErrorsKeepStreamOpen) {
+    AscndClient client(config);
+
+    auto missing = client.get_player_rank("leaderboard", "missing");
+    ASSERT_TRUE(missing.is_error());
+    EXPECT_EQ(missing.error_code(), static_cast<int>(grpc::StatusCode::NOT_FOUND));
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+    EXPECT_EQ(service.session_calls.load(), 1);
+}
+
+TEST_F(SessionTest, DeadlineAppliesPerRequest) {
+    service.read_delay_ms = 500;
+    config.request_timeout_ms = 100;
+    AscndClient client(config);
+
+    auto leaderboard = client.get_leaderboard("leaderboard", 3);
+    ASSERT_TRUE(leaderboard.is_error());
+    EXPECT_EQ(leaderboard.error_code(), static_cast<int>(grpc::StatusCode::DEADLINE_EXCEEDED));
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+    EXPECT_EQ(service.session_calls.load(), 1);
+}
+
+TEST_F(SessionTest, FallsBackWhenServerLacksSessions) {
+    service.session_supported = false;
+    AscndClient client(config);
+
+    auto first = client.submit_score("leaderboard", "player", 100);
+    auto second = client.submit_score("leaderboard", "player", 200);
+
+    ASSERT_TRUE(first.is_ok()) << first.error();
+    ASSERT_TRUE(second.is_ok()) << second.error();
+    EXPECT_EQ(service.session_calls.load(), 0);
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+// The stream's metadata is fixed, so a new key opens a new stream
+TEST_F(SessionTest, ApiKeyChangeOpensNewStream) {
+    AscndClient client(config);
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+
+    client.set_api_key("other-key");
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+
+    EXPECT_EQ(service.last_authorization(), "Bearer other-key");
+    EXPECT_EQ(service.session_calls.load(), 2);
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,118 @@
+/**
+ * @file sharded_client_test.cpp
+ * @brief Tests for per-thread client shards
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/sharded_client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <set>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+class ShardedClientTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+
+        service.set_player_rank("leaderboard", "player", 7);
+    }
+};
+
+TEST_F(ShardedClientTest, InvalidConfigThrows) {
+    config.server_address.clear();
+    EXPECT_THROW(ShardedClient(config, 2), std::invalid_argument);
+}
+
+TEST_F(ShardedClientTest, DefaultsToOneShardPerHardwareThread) {
+    ShardedClient clients(config);
+    EXPECT_EQ(clients.shard_count(), std::max(1u, std::thread::hardware_concurrency()));
+}
+
+TEST_F(ShardedClientTest, LocalShardIsStablePerThread) {
+    ShardedClient clients(config, 4);
+    AscndClient* first = &clients.local();
+    EXPECT_EQ(&clients.local(), first);
+}
+
+TEST_F(ShardedClientTest, ThreadsAreSpreadOverShards) {
+    ShardedClient clients(config, 4);
+
+    std::vector<AscndClient*> assigned(4);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < assigned.size(); ++i) {
+        threads.emplace_back([&clients, &assigned, i]() { assigned[i] = &clients.local(); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(std::set<AscndClient*>(assigned.begin(), assigned.end()).size(), 4u);
+}
+
+TEST_F(ShardedClientTest, ShardIndexOutOfRangeThrows) {
+    ShardedClient clients(config, 2);
+    EXPECT_NO_THROW((void)clients.shard(1));
+    EXPECT_THROW((void)clients.shard(2), std::out_of_range);
+}
+
+TEST_F(ShardedClientTest, ShardsUseSeparateConnections) {
+    ShardedClient clients(config, 3);
+    for (size_t i = 0; i < clients.shard_count(); ++i) {
+        ASSERT_TRUE(clients.shard(i).get_player_rank("leaderboard", "player").is_ok());
+    }
+
+    EXPECT_EQ(service.peer_count(), 3u);
+}
+
+TEST_F(ShardedClientTest, ClientsShareConnectionByDefault) {
+    AscndClient first(config);
+    AscndClient second(config);
+    ASSERT_TRUE(first.get_player_rank("leaderboard", "player").is_ok());
+    ASSERT_TRUE(second.get_player_rank("leaderboard", "player").is_ok());
+
+    EXPECT_EQ(service.peer_count(), 1u);
+}
+
+// Each shard caches on its own; stats() totals them
+TEST_F(ShardedClientTest, StatsAreMergedAcrossShards) {
+    config.player_rank_cache_ms = 60000;
+    ShardedClient clients(config, 3);
+    for (size_t i = 0; i < clients.shard_count(); ++i) {
+        ASSERT_TRUE(clients.shard(i).get_player_rank("leaderboard", "player").is_ok());
+        ASSERT_TRUE(clients.shard(i).get_player_rank("leaderboard", "player").is_ok());
+    }
+
+    EXPECT_EQ(service.rank_calls.load(), 3);
+    EXPECT_EQ(clients.shard(0).stats().player_rank_cache_hits, 1u);
+    EXPECT_EQ(clients.stats().player_rank_cache_hits, 3u);
+}
+
+TEST_F(ShardedClientTest, SetApiKeyUpdatesEveryShard) {
+    ShardedClient clients(config, 2);
+    clients.set_api_key("rotated-key");
+
+    EXPECT_EQ(clients.shard(0).config().api_key, "rotated-key");
+    EXPECT_EQ(clients.shard(1).config().api_key, "rotated-key");
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -0,0 +1,40 @@
+/**
+ * @file c_api_driver.cpp
+ * @brief Runs the C API harness against a fake server
+ *
+ * The harness links only the ascnd_c shared library, which carries its own
+ * copy of the generated protobuf code, so the fake server runs here in a
+ * separate process and its address is passed on the command line.
+ */
+
+#include "support/fake_server.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#endif
+
+int main(int argc, char** argv) {
+    if (argc != 2) {
+        std::fprintf(stderr, "usage: %s <c_api_test>\n", argv[0]);
+        return 2;
+    }
+
+    ascnd::testing::FakeAscndService service;
+    service.set_player_rank("leaderboard", "player", 7);
+    ascnd::testing::FakeServer server(&service);
+    if (server.port() == 0) {
+        std::fprintf(stderr, "fake server failed to start\n");
+        return 1;
+    }
+
+    const std::string command = std::string("\"") + argv[1] + "\" " + server.address();
+    int status = std::system(command.c_str());
+#ifndef _WIN32
+    status = WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+#endif
+    return status;
+}
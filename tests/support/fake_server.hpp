@@ -0,0 +1,549 @@
+#pragma once
+
+/**
+ * @file fake_server.hpp
+ * @brief In-process stand-in for the Ascnd API used by tests and benchmarks
+ *
+ * Runs a real gRPC server on a loopback port with canned responses so the
+ * client can be exercised end to end without network access.
+ */
+
+#include "ascnd.grpc.pb.h"
+
+#include <grpc/grpc_security_constants.h>
+#include <grpcpp/grpcpp.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ascnd {
+namespace testing {
+
+/**
+ * @brief Minimal AscndService implementation with call counters
+ */
+class FakeAscndService : public ::ascnd::v1::AscndService::Service {
+public:
+    std::atomic<int> submit_calls{0};
+    std::atomic<int> leaderboard_calls{0};
+    std::atomic<int> rank_calls{0};
+
+    std::atomic<int> batch_calls{0};
+    std::atomic<int> stream_calls{0};
+    std::atomic<int> streamed_submissions{0};
+    std::atomic<int> session_calls{0};
+    std::atomic<int> watch_calls{0};
+    std::atomic<int> rules_calls{0};
+
+    /// SubmitScore calls that asked for the response to be omitted
+    std::atomic<int> omitted_responses{0};
+
+    /// Calls that arrived over a TLS connection established by resumption
+    std::atomic<int> resumed_session_calls{0};
+
+    /// Artificial latency added to GetLeaderboard and GetPlayerRank
+    std::atomic<int> read_delay_ms{0};
+
+    /// Artificial latency added to GetLeaderboardRules
+    std::atomic<int> rules_delay_ms{0};
+
+    /// Artificial latency added before each SubmitScoreStream acknowledgement
+    std::atomic<int> ack_delay_ms{0};
+
+    /// When positive, SubmitScoreStream fails with UNAVAILABLE upon reading
+    /// this many submissions, leaving the last one unacknowledged
+    std::atomic<int> stream_fail_after{0};
+
+    /// Number of anticheat violations attached to each SubmitScore response
+    std::atomic<int> anticheat_violations{0};
+
+    /// When false, SubmitScoreBatch returns UNIMPLEMENTED
+    std::atomic<bool> batch_supported{true};
+
+    /// SubmitScoreBatch calls still to fail with UNAVAILABLE (not counted
+    /// in batch_calls)
+    std::atomic<int> batch_failures{0};
+
+    /// GetPlayerRanks calls (not counted in rank_calls)
+    std::atomic<int> ranks_batch_calls{0};
+
+    /// When false, GetPlayerRanks returns UNIMPLEMENTED
+    std::atomic<bool> ranks_batch_supported{true};
+
+    /// When false, Session returns UNIMPLEMENTED
+    std::atomic<bool> session_supported{true};
+
+    /// When false, GetLeaderboardRules returns UNIMPLEMENTED
+    std::atomic<bool> rules_supported{true};
+
+    /// Set the rules GetLeaderboardRules returns for rules.leaderboard_id().
+    /// Other leaderboards have anticheat disabled.
+    void set_rules(const ::ascnd::v1::GetLeaderboardRulesResponse& rules) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rules_[rules.leaderboard_id()] = rules;
+    }
+
+    /// Set a player's rank and push the change to every stream watching them.
+    /// Players start at rank 1.
+    void set_player_rank(const std::string& leaderboard_id, const std::string& player_id, int rank) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto key = std::make_pair(leaderboard_id, player_id);
+        auto it = ranks_.find(key);
+        int previous = it == ranks_.end() ? 1 : it->second;
+        ranks_[key] = rank;
+        for (Watch* watch : watches_) {
+            if (watch->players.count(key) > 0) {
+                watch->stream->Write(rank_event(leaderboard_id, player_id, &previous, rank));
+            }
+        }
+    }
+
+    /// Authorization metadata of the most recent call
+    std::string last_authorization() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return last_authorization_;
+    }
+
+    /// Deadline of the most recent call
+    std::chrono::system_clock::time_point last_deadline() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return last_deadline_;
+    }
+
+    /// Number of distinct client connections (peer addresses) seen
+    size_t peer_count() const {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return peers_.size();
+    }
+
+    grpc::Status SubmitScore(grpc::ServerContext* context,
+                             const ::ascnd::v1::SubmitScoreRequest* request,
+                             ::ascnd::v1::SubmitScoreResponse* response) override {
+        record_peer(context);
+        ++submit_calls;
+        if (request->leaderboard_id() == "missing") {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "leaderboard not found");
+        }
+        if (request->omit_response()) {
+            ++omitted_responses;
+            return grpc::Status::OK;
+        }
+        response->set_score_id("score-" + std::to_string(submit_calls.load()));
+        response->set_rank(1);
+        response->set_is_new_best(request->score() > 0);
+
+        int violations = anticheat_violations.load();
+        if (violations > 0) {
+            auto* anticheat = response->mutable_anticheat();
+            anticheat->set_passed(false);
+            anticheat->set_action("flag");
+            for (int i = 0; i < violations; ++i) {
+                auto* violation = anticheat->add_violations();
+                violation->set_flag_type("score_velocity_" + std::to_string(i));
+                violation->set_reason("Score increased faster than the configured limit allows");
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetLeaderboard(grpc::ServerContext* context,
+                                const ::ascnd::v1::GetLeaderboardRequest* request,
+                                ::ascnd::v1::GetLeaderboardResponse* response) override {
+        record_peer(context);
+        ++leaderboard_calls;
+        delay_read();
+        // The top three players are in the gold bracket, the rest in silver
+        ::ascnd::v1::BracketInfo brackets[2];
+        brackets[0].set_id("bracket-gold");
+        brackets[0].set_name("Gold");
+        brackets[0].set_color("#FFD700");
+        brackets[1].set_id("bracket-silver");
+        brackets[1].set_name("Silver");
+        brackets[1].set_color("#C0C0C0");
+        if (request->bracket_dictionary()) {
+            *response->add_brackets() = brackets[0];
+            *response->add_brackets() = brackets[1];
+        }
+
+        int limit = request->has_limit() ? request->limit() : 10;
+        for (int i = 0; i < limit; ++i) {
+            auto* entry = response->add_entries();
+            entry->set_rank(i + 1);
+            entry->set_player_id("player-" + std::to_string(i + 1));
+            entry->set_score(1000 - i);
+            int bracket = i < 3 ? 0 : 1;
+            if (request->bracket_dictionary()) {
+                entry->set_bracket_index(bracket);
+            } else {
+                *entry->mutable_bracket() = brackets[bracket];
+            }
+        }
+        response->set_total_entries(limit);
+        response->set_period_start("2024-01-01T00:00:00Z");
+        if (request->has_view_slug()) {
+            response->mutable_view()->set_slug(request->view_slug());
+            response->mutable_view()->set_name("View " + request->view_slug());
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetPlayerRank(grpc::ServerContext* context,
+                               const ::ascnd::v1::GetPlayerRankRequest* request,
+                               ::ascnd::v1::GetPlayerRankResponse* response) override {
+        record_peer(context);
+        ++rank_calls;
+        delay_read();
+        return lookup_rank(request, response);
+    }
+
+    grpc::Status GetPlayerRanks(grpc::ServerContext* context,
+                                const ::ascnd::v1::GetPlayerRanksRequest* request,
+                                ::ascnd::v1::GetPlayerRanksResponse* response) override {
+        record_peer(context);
+        if (!ranks_batch_supported) {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "GetPlayerRanks not supported");
+        }
+        ++ranks_batch_calls;
+        delay_read();
+        for (const auto& player_id : request->player_ids()) {
+            ::ascnd::v1::GetPlayerRankRequest single;
+            single.set_leaderboard_id(request->leaderboard_id());
+            single.set_player_id(player_id);
+            if (request->has_period()) {
+                single.set_period(request->period());
+            }
+            if (request->has_view_slug()) {
+                single.set_view_slug(request->view_slug());
+            }
+            auto* result = response->add_results();
+            grpc::Status status = lookup_rank(&single, result->mutable_response());
+            if (!status.ok()) {
+                result->clear_response();
+                result->set_error_code(static_cast<int32_t>(status.error_code()));
+                result->set_error_message(status.error_message());
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status lookup_rank(const ::ascnd::v1::GetPlayerRankRequest* request,
+                             ::ascnd::v1::GetPlayerRankResponse* response) {
+        if (request->player_id() == "missing") {
+            return grpc::Status(grpc::StatusCode::NOT_FOUND, "player not found");
+        }
+        int rank = 1;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            auto it = ranks_.find(std::make_pair(request->leaderboard_id(), request->player_id()));
+            if (it != ranks_.end()) {
+                rank = it->second;
+            }
+        }
+        response->set_score(1000);
+        response->set_best_score(1000);
+
+        // Within a view the player is always first; their global rank is the
+        // one set with set_player_rank()
+        if (request->has_view_slug()) {
+            response->set_rank(1);
+            response->set_total_entries(1);
+            response->mutable_view()->set_slug(request->view_slug());
+            response->mutable_view()->set_name("View " + request->view_slug());
+            response->set_global_rank(rank);
+            response->set_global_total_entries(1);
+        } else {
+            response->set_rank(rank);
+            response->set_total_entries(1);
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SubmitScoreBatch(grpc::ServerContext* context,
+                                  const ::ascnd::v1::SubmitScoreBatchRequest* request,
+                                  ::ascnd::v1::SubmitScoreBatchResponse* response) override {
+        record_peer(context);
+        if (!batch_supported) {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "SubmitScoreBatch not supported");
+        }
+        int failures = batch_failures.load();
+        while (failures > 0 && !batch_failures.compare_exchange_weak(failures, failures - 1)) {
+        }
+        if (failures > 0) {
+            return grpc::Status(grpc::StatusCode::UNAVAILABLE, "SubmitScoreBatch failed");
+        }
+        ++batch_calls;
+        for (const auto& submission : request->submissions()) {
+            record_submission(submission, "batch-score-", response->add_results());
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status GetLeaderboardRules(grpc::ServerContext* context,
+                                     const ::ascnd::v1::GetLeaderboardRulesRequest* request,
+                                     ::ascnd::v1::GetLeaderboardRulesResponse* response) override {
+        record_peer(context);
+        if (!rules_supported) {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "GetLeaderboardRules not supported");
+        }
+        ++rules_calls;
+        int delay = rules_delay_ms.load();
+        if (delay > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        auto it = rules_.find(request->leaderboard_id());
+        if (it != rules_.end()) {
+            *response = it->second;
+        } else {
+            response->set_leaderboard_id(request->leaderboard_id());
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status SubmitScoreStream(
+        grpc::ServerContext* context,
+        grpc::ServerReaderWriter<::ascnd::v1::ScoreStreamAck,
+                                 ::ascnd::v1::ScoreStreamRequest>* stream) override {
+        record_peer(context);
+        ++stream_calls;
+        ::ascnd::v1::ScoreStreamRequest request;
+        int received = 0;
+        while (stream->Read(&request)) {
+            ++received;
+            int fail_after = stream_fail_after.load();
+            if (fail_after > 0 && received >= fail_after) {
+                return grpc::Status(grpc::StatusCode::UNAVAILABLE, "stream reset");
+            }
+            ++streamed_submissions;
+            int delay = ack_delay_ms.load();
+            if (delay > 0) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+            }
+            ::ascnd::v1::ScoreStreamAck ack;
+            ack.set_sequence(request.sequence());
+            record_submission(request.submission(), "stream-score-", ack.mutable_result());
+            if (!stream->Write(ack)) {
+                break;
+            }
+        }
+        return grpc::Status::OK;
+    }
+
+    // Each session request is served on its own thread, so responses are
+    // written in completion order rather than request order
+    grpc::Status Session(
+        grpc::ServerContext* context,
+        grpc::ServerReaderWriter<::ascnd::v1::SessionResponse,
+                                 ::ascnd::v1::SessionRequest>* stream) override {
+        if (!session_supported) {
+            return grpc::Status(grpc::StatusCode::UNIMPLEMENTED, "Session not supported");
+        }
+        ++session_calls;
+        std::mutex write_mutex;
+        std::vector<std::thread> workers;
+        ::ascnd::v1::SessionRequest request;
+        while (stream->Read(&request)) {
+            workers.emplace_back([this, context, stream, &write_mutex, request]() {
+                ::ascnd::v1::SessionResponse response;
+                response.set_request_id(request.request_id());
+                grpc::Status status;
+                switch (request.request_case()) {
+                    case ::ascnd::v1::SessionRequest::kSubmitScore:
+                        status = SubmitScore(context, &request.submit_score(),
+                                             response.mutable_submit_score());
+                        break;
+                    case ::ascnd::v1::SessionRequest::kGetLeaderboard:
+                        status = GetLeaderboard(context, &request.get_leaderboard(),
+                                                response.mutable_get_leaderboard());
+                        break;
+                    case ::ascnd::v1::SessionRequest::kGetPlayerRank:
+                        status = GetPlayerRank(context, &request.get_player_rank(),
+                                               response.mutable_get_player_rank());
+                        break;
+                    default:
+                        status = grpc::Status(grpc::StatusCode::INVALID_ARGUMENT, "empty request");
+                        break;
+                }
+                if (!status.ok()) {
+                    response.clear_response();
+                    response.set_error_code(static_cast<int>(status.error_code()));
+                    response.set_error_message(status.error_message());
+                }
+                std::lock_guard<std::mutex> lock(write_mutex);
+                stream->Write(response);
+            });
+        }
+        for (auto& worker : workers) {
+            worker.join();
+        }
+        return grpc::Status::OK;
+    }
+
+    grpc::Status WatchPlayerRanks(
+        grpc::ServerContext* context,
+        grpc::ServerReaderWriter<::ascnd::v1::RankChangeEvent,
+                                 ::ascnd::v1::WatchPlayerRanksRequest>* stream) override {
+        record_peer(context);
+        ++watch_calls;
+        Watch watch{stream, {}};
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            watches_.push_back(&watch);
+        }
+
+        ::ascnd::v1::WatchPlayerRanksRequest request;
+        while (stream->Read(&request)) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            for (const auto& player_id : request.remove_player_ids()) {
+                watch.players.erase(std::make_pair(request.leaderboard_id(), player_id));
+            }
+            for (const auto& player_id : request.add_player_ids()) {
+                auto key = std::make_pair(request.leaderboard_id(), player_id);
+                watch.players.insert(key);
+                auto it = ranks_.find(key);
+                stream->Write(rank_event(request.leaderboard_id(), player_id, nullptr,
+                                         it == ranks_.end() ? 1 : it->second));
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(mutex_);
+        watches_.erase(std::find(watches_.begin(), watches_.end(), &watch));
+        return grpc::Status::OK;
+    }
+
+protected:
+    // Negative scores are rejected per submission, as the real API does
+    static void record_submission(const ::ascnd::v1::SubmitScoreRequest& submission,
+                                  const std::string& id_prefix,
+                                  ::ascnd::v1::SubmitScoreResult* result) {
+        if (submission.score() < 0) {
+            result->set_error_code(static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+            result->set_error_message("score must not be negative");
+            return;
+        }
+        auto* submitted = result->mutable_response();
+        submitted->set_score_id(id_prefix + submission.player_id());
+        submitted->set_rank(1);
+        submitted->set_is_new_best(true);
+    }
+
+    void delay_read() {
+        int delay = read_delay_ms.load();
+        if (delay > 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+        }
+    }
+
+    void record_peer(grpc::ServerContext* context) {
+        {
+            auto it = context->client_metadata().find("authorization");
+            std::lock_guard<std::mutex> lock(mutex_);
+            last_authorization_ = it == context->client_metadata().end()
+                ? std::string()
+                : std::string(it->second.data(), it->second.size());
+            last_deadline_ = context->deadline();
+            peers_.insert(context->peer());
+        }
+
+        auto auth = context->auth_context();
+        if (!auth) {
+            return;
+        }
+        auto reused = auth->FindPropertyValues(GRPC_SSL_SESSION_REUSED_PROPERTY);
+        if (!reused.empty() && reused.front() == "true") {
+            ++resumed_session_calls;
+        }
+    }
+
+private:
+    struct Watch {
+        grpc::ServerReaderWriter<::ascnd::v1::RankChangeEvent,
+                                 ::ascnd::v1::WatchPlayerRanksRequest>* stream;
+        std::set<std::pair<std::string, std::string>> players;
+    };
+
+    static ::ascnd::v1::RankChangeEvent rank_event(const std::string& leaderboard_id,
+                                                   const std::string& player_id,
+                                                   const int* previous_rank, int rank) {
+        ::ascnd::v1::RankChangeEvent event;
+        event.set_leaderboard_id(leaderboard_id);
+        event.set_player_id(player_id);
+        if (previous_rank) {
+            event.set_previous_rank(*previous_rank);
+        }
+        event.set_rank(rank);
+        event.set_score(1000 - rank);
+        event.set_total_entries(100);
+        return event;
+    }
+
+    mutable std::mutex mutex_;
+    std::string last_authorization_;
+    std::chrono::system_clock::time_point last_deadline_;
+    std::set<std::string> peers_;
+
+    // Guarded by mutex_, which also serializes writes to watch streams
+    std::map<std::pair<std::string, std::string>, int> ranks_;
+    std::vector<Watch*> watches_;
+    std::map<std::string, ::ascnd::v1::GetLeaderboardRulesResponse> rules_;
+};
+
+/**
+ * @brief Owns a gRPC server hosting a service
+ *
+ * Listens on a free loopback TCP port by default; pass a listen address such
+ * as "unix:/tmp/ascnd.sock" to serve a Unix domain socket instead.
+ */
+class FakeServer {
+public:
+    explicit FakeServer(grpc::Service* service,
+                        std::shared_ptr<grpc::ServerCredentials> credentials =
+                            grpc::InsecureServerCredentials(),
+                        const std::string& listen_address = "127.0.0.1:0") {
+        grpc::ServerBuilder builder;
+        builder.AddListeningPort(listen_address, std::move(credentials), &port_);
+        builder.RegisterService(service);
+        server_ = builder.BuildAndStart();
+
+        const std::string any_port = ":0";
+        bool picks_port = listen_address.size() >= any_port.size() &&
+                          listen_address.compare(listen_address.size() - any_port.size(),
+                                                 any_port.size(), any_port) == 0;
+        address_ = picks_port
+            ? listen_address.substr(0, listen_address.size() - 1) + std::to_string(port_)
+            : listen_address;
+    }
+
+    ~FakeServer() {
+        if (server_) {
+            server_->Shutdown();
+        }
+    }
+
+    FakeServer(const FakeServer&) = delete;
+    FakeServer& operator=(const FakeServer&) = delete;
+
+    /// Address clients should connect to (e.g. "127.0.0.1:41234")
+    const std::string& address() const { return address_; }
+
+    int port() const { return port_; }
+
+    grpc::Server* server() { return server_.get(); }
+
+private:
+    int port_ = 0;
+    std::string address_;
+    std::unique_ptr<grpc::Server> server_;
+};
+
+} // namespace testing
+} // namespace ascnd
@@ -0,0 +1,143 @@
+/**
+ * @file thread_affinity_test.cpp
+ * @brief Tests for pinning client threads to CPUs and NUMA nodes
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <algorithm>
+#include <future>
+#include <memory>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace ascnd {
+namespace {
+
+// CPUs the calling thread may run on, or empty if unknown
+std::vector<int> CurrentAffinity() {
+    std::vector<int> cpus;
+#if defined(__linux__)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &set)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+#endif
+    return cpus;
+}
+
+class ThreadAffinityTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+#if !defined(__linux__)
+        GTEST_SKIP() << "Thread affinity is only supported on Linux";
+#endif
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+
+        service.set_player_rank("leaderboard", "player", 3);
+    }
+
+    // The first CPU this process may use; always online
+    static int first_cpu() {
+        auto cpus = CurrentAffinity();
+        return cpus.empty() ? 0 : cpus.front();
+    }
+};
+
+TEST_F(ThreadAffinityTest, CallbackThreadsArePinned) {
+    const int cpu = first_cpu();
+    config.callback_thread_affinity.cpus = {cpu};
+    AscndClient client(config);
+
+    std::promise<std::vector<int>> affinity;
+    client.get_player_rank_async(GetPlayerRankRequest(), [&](Result<GetPlayerRankResponse>) {
+        affinity.set_value(CurrentAffinity());
+    });
+
+    EXPECT_EQ(affinity.get_future().get(), std::vector<int>{cpu});
+}
+
+TEST_F(ThreadAffinityTest, CompletionThreadsArePinned) {
+    const int cpu = first_cpu();
+    config.completion_thread_affinity.cpus = {cpu};
+    AscndClient client(config);
+
+    std::promise<std::vector<int>> affinity;
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(100);
+    client.submit_score_fire_and_forget(request, [&](int, const std::string&) {
+        affinity.set_value(CurrentAffinity());
+    });
+
+    EXPECT_EQ(affinity.get_future().get(), std::vector<int>{cpu});
+}
+
+TEST_F(ThreadAffinityTest, UnpinnedByDefault) {
+    const std::vector<int> process_cpus = CurrentAffinity();
+    AscndClient client(config);
+
+    std::promise<std::vector<int>> affinity;
+    client.get_player_rank_async(GetPlayerRankRequest(), [&](Result<GetPlayerRankResponse>) {
+        affinity.set_value(CurrentAffinity());
+    });
+
+    EXPECT_EQ(affinity.get_future().get(), process_cpus);
+}
+
+TEST_F(ThreadAffinityTest, UnknownNumaNodeLeavesThreadsUnpinned) {
+    const std::vector<int> process_cpus = CurrentAffinity();
+    config.callback_thread_affinity.numa_nodes = {4095};
+    AscndClient client(config);
+
+    std::promise<std::vector<int>> affinity;
+    client.get_player_rank_async(GetPlayerRankRequest(), [&](Result<GetPlayerRankResponse>) {
+        affinity.set_value(CurrentAffinity());
+    });
+
+    EXPECT_EQ(affinity.get_future().get(), process_cpus);
+}
+
+TEST_F(ThreadAffinityTest, NumaNodePinsToItsCpus) {
+    config.callback_thread_affinity.numa_nodes = {0};
+    AscndClient client(config);
+
+    std::promise<std::vector<int>> affinity;
+    client.get_player_rank_async(GetPlayerRankRequest(), [&](Result<GetPlayerRankResponse>) {
+        affinity.set_value(CurrentAffinity());
+    });
+
+    // Node 0 exists on every Linux system with NUMA support in sysfs; the
+    // pinned set is a subset of the CPUs the process may use
+    auto pinned = affinity.get_future().get();
+    ASSERT_FALSE(pinned.empty());
+    const std::vector<int> process_cpus = CurrentAffinity();
+    for (int cpu : pinned) {
+        EXPECT_NE(std::find(process_cpus.begin(), process_cpus.end(), cpu), process_cpus.end()) << cpu;
+    }
+}
+
+}  // namespace
+}  // namespace ascnd
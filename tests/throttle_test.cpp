@@ -0,0 +1,176 @@
+/**
+ * @file throttle_test.cpp
+ * @brief Tests for per-player submission throttling
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+namespace ascnd {
+namespace {
+
+class ThrottleTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+    }
+};
+
+TEST_F(ThrottleTest, OffByDefault) {
+    AscndClient client(config);
+    for (int i = 0; i < 10; ++i) {
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", i).is_ok());
+    }
+
+    EXPECT_EQ(service.submit_calls.load(), 10);
+    EXPECT_EQ(client.stats().submissions_delayed, 0u);
+    EXPECT_EQ(client.stats().submissions_throttled, 0u);
+}
+
+TEST_F(ThrottleTest, RejectModeFailsBurstsWithoutSending) {
+    config.player_submission_limit = 2;
+    config.player_submission_window_ms = 60000;
+    config.player_throttle_mode = ThrottleMode::kReject;
+    AscndClient client(config);
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 2).is_ok());
+    auto result = client.submit_score("leaderboard", "player", 3);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error_code(), static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+    EXPECT_EQ(service.submit_calls.load(), 2);
+    EXPECT_EQ(client.stats().submissions_throttled, 1u);
+}
+
+// Each (leaderboard, player) pair has its own window
+TEST_F(ThrottleTest, WindowsArePerPlayerAndLeaderboard) {
+    config.player_submission_limit = 1;
+    config.player_submission_window_ms = 60000;
+    config.player_throttle_mode = ThrottleMode::kReject;
+    AscndClient client(config);
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+    EXPECT_TRUE(client.submit_score("leaderboard", "other-player", 1).is_ok());
+    EXPECT_TRUE(client.submit_score("other-leaderboard", "player", 1).is_ok());
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 2).is_error());
+}
+
+TEST_F(ThrottleTest, WindowSlides) {
+    config.player_submission_limit = 1;
+    config.player_submission_window_ms = 50;
+    config.player_throttle_mode = ThrottleMode::kReject;
+    AscndClient client(config);
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+    std::this_thread::sleep_for(std::chrono::milliseconds(60));
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 2).is_ok());
+}
+
+TEST_F(ThrottleTest, DelayModeSpacesOutBursts) {
+    config.player_submission_limit = 2;
+    config.player_submission_window_ms = 200;
+    AscndClient client(config);
+
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(client.submit_score("leaderboard", "player", i).is_ok());
+    }
+    auto elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, std::chrono::milliseconds(190));
+    EXPECT_EQ(service.submit_calls.load(), 3);
+    EXPECT_EQ(client.stats().submissions_delayed, 1u);
+    EXPECT_EQ(client.stats().submissions_throttled, 0u);
+}
+
+// A delay that would outlast the request timeout fails right away
+TEST_F(ThrottleTest, DelayBeyondRequestTimeoutFails) {
+    config.player_submission_limit = 1;
+    config.player_submission_window_ms = 60000;
+    config.request_timeout_ms = 100;
+    AscndClient client(config);
+
+    EXPECT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+    auto start = std::chrono::steady_clock::now();
+    auto result = client.submit_score("leaderboard", "player", 2);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error_code(), static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_EQ(client.stats().submissions_throttled, 1u);
+}
+
+TEST_F(ThrottleTest, FireAndForgetIsThrottled) {
+    config.player_submission_limit = 1;
+    config.player_submission_window_ms = 60000;
+    config.player_throttle_mode = ThrottleMode::kReject;
+    AscndClient client(config);
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    int error_code = 0;
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(2);
+    client.submit_score_fire_and_forget(request, [&](int code, const std::string&) {
+        std::lock_guard<std::mutex> lock(mutex);
+        error_code = code;
+        done = true;
+        cv.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return done; }));
+    EXPECT_EQ(error_code, static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+// Fire-and-forget never sleeps on the caller's thread, even in delay mode
+TEST_F(ThrottleTest, FireAndForgetIsNotDelayed) {
+    config.player_submission_limit = 1;
+    config.player_submission_window_ms = 60000;
+    config.player_throttle_mode = ThrottleMode::kDelay;
+    AscndClient client(config);
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 1).is_ok());
+
+    std::promise<int> error_code;
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(2);
+    auto start = std::chrono::steady_clock::now();
+    client.submit_score_fire_and_forget(request, [&](int code, const std::string&) {
+        error_code.set_value(code);
+    });
+
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(100));
+    EXPECT_EQ(error_code.get_future().get(), static_cast<int>(grpc::StatusCode::RESOURCE_EXHAUSTED));
+    EXPECT_EQ(client.stats().submissions_delayed, 0u);
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+}  // namespace
+}  // namespace ascnd
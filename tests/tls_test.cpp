@@ -0,0 +1,244 @@
+/**
+ * @file tls_test.cpp
+ * @brief TLS tests against a local stand-in server with self-signed certificates
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+#include "support/test_certs.hpp"
+
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace ascnd {
+namespace {
+
+// gRPC reads its default root store once per process, so point it at the
+// self-signed test certificate before any credentials are created.
+class DefaultRootsEnvironment : public ::testing::Environment {
+public:
+    static int current_pid() {
+#ifdef _WIN32
+        return _getpid();
+#else
+        return static_cast<int>(getpid());
+#endif
+    }
+
+    void SetUp() override {
+        // Per-process file name: ctest may run test cases concurrently
+        path_ = ::testing::TempDir() + "ascnd_tls_test_roots_" +
+                std::to_string(current_pid()) + ".pem";
+        std::ofstream(path_) << testing::kServerCertPem;
+#ifdef _WIN32
+        _putenv_s("GRPC_DEFAULT_SSL_ROOTS_FILE_PATH", path_.c_str());
+#else
+        setenv("GRPC_DEFAULT_SSL_ROOTS_FILE_PATH", path_.c_str(), 1);
+#endif
+    }
+
+    void TearDown() override {
+        std::remove(path_.c_str());
+    }
+
+private:
+    std::string path_;
+};
+
+const auto* const g_roots_environment =
+    ::testing::AddGlobalTestEnvironment(new DefaultRootsEnvironment);
+
+std::shared_ptr<grpc::ServerCredentials> ServerTlsCredentials() {
+    grpc::SslServerCredentialsOptions options;
+    options.pem_key_cert_pairs.push_back({testing::kServerKeyPem, testing::kServerCertPem});
+    return grpc::SslServerCredentials(options);
+}
+
+class TlsTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service, ServerTlsCredentials());
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = "localhost:" + std::to_string(server->port());
+        config.api_key = "test-key";
+        config.use_ssl = true;
+        config.connection_timeout_ms = 5000;
+        config.request_timeout_ms = 5000;
+        config.max_retries = 0;
+    }
+};
+
+// A client using default SSL options can reach the stand-in server
+TEST_F(TlsTest, SslRequestSucceeds) {
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(service.rank_calls.load(), 1);
+}
+
+// Multiple clients share the process-wide credentials
+TEST_F(TlsTest, MultipleClientsShareCredentials) {
+    AscndClient first(config);
+    AscndClient second(config);
+
+    EXPECT_TRUE(first.get_player_rank("leaderboard", "player").is_ok());
+    EXPECT_TRUE(second.get_player_rank("leaderboard", "player").is_ok());
+    EXPECT_EQ(service.rank_calls.load(), 2);
+}
+
+// A new connection after a previous one closed resumes the TLS session
+TEST_F(TlsTest, ReconnectResumesSession) {
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+    }
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+    }
+
+    EXPECT_GE(service.resumed_session_calls.load(), 1);
+}
+
+// Resumption can be disabled per client
+TEST_F(TlsTest, ResumptionCanBeDisabled) {
+    config.tls_session_resumption = false;
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+    }
+    {
+        AscndClient client(config);
+        ASSERT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+    }
+
+    EXPECT_EQ(service.resumed_session_calls.load(), 0);
+}
+
+// Explicit in-memory roots are used instead of the default root store
+TEST_F(TlsTest, CustomRootCertsSucceed) {
+    config.tls_root_certs_pem = testing::kServerCertPem;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_ok()) << result.error();
+}
+
+// Roots that do not cover the server certificate are rejected
+TEST_F(TlsTest, WrongRootCertsFail) {
+    config.tls_root_certs_pem = testing::kOtherServerCertPem;
+    config.request_timeout_ms = 1000;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(service.rank_calls.load(), 0);
+}
+
+// A pinned certificate matching the server is accepted
+TEST_F(TlsTest, PinnedCertificateMatches) {
+    config.tls_pinned_server_cert_pem = testing::kServerCertPem;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_ok()) << result.error();
+}
+
+// A pinned certificate that does not match the server is rejected
+TEST_F(TlsTest, PinnedCertificateMismatchFails) {
+    config.tls_pinned_server_cert_pem = testing::kOtherServerCertPem;
+    config.request_timeout_ms = 1000;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(service.rank_calls.load(), 0);
+}
+
+// Pinning combined with explicit roots verifies both
+TEST_F(TlsTest, PinnedCertificateWithRoots) {
+    config.tls_root_certs_pem = testing::kServerCertPem;
+    config.tls_pinned_server_cert_pem = testing::kServerCertPem;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_ok()) << result.error();
+}
+
+class MutualTlsTest : public TlsTest {
+protected:
+    void SetUp() override {
+        grpc::SslServerCredentialsOptions options(
+            GRPC_SSL_REQUEST_AND_REQUIRE_CLIENT_CERTIFICATE_AND_VERIFY);
+        options.pem_root_certs = testing::kClientCertPem;
+        options.pem_key_cert_pairs.push_back({testing::kServerKeyPem, testing::kServerCertPem});
+        server = std::make_unique<testing::FakeServer>(&service, grpc::SslServerCredentials(options));
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = "localhost:" + std::to_string(server->port());
+        config.api_key = "test-key";
+        config.use_ssl = true;
+        config.connection_timeout_ms = 5000;
+        config.request_timeout_ms = 1000;
+        config.max_retries = 0;
+        config.tls_root_certs_pem = testing::kServerCertPem;
+    }
+};
+
+// The server accepts a client presenting the expected certificate
+TEST_F(MutualTlsTest, ClientCertificateAccepted) {
+    config.tls_client_cert_pem = testing::kClientCertPem;
+    config.tls_client_key_pem = testing::kClientKeyPem;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_ok()) << result.error();
+}
+
+// Without a client certificate the handshake fails
+TEST_F(MutualTlsTest, MissingClientCertificateFails) {
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_error());
+    EXPECT_EQ(service.rank_calls.load(), 0);
+}
+
+// Client certificates also work together with a pinned server certificate
+TEST_F(MutualTlsTest, ClientCertificateWithPinning) {
+    config.tls_client_cert_pem = testing::kClientCertPem;
+    config.tls_client_key_pem = testing::kClientKeyPem;
+    config.tls_pinned_server_cert_pem = testing::kServerCertPem;
+    AscndClient client(config);
+
+    auto result = client.get_player_rank("leaderboard", "player");
+
+    EXPECT_TRUE(result.is_ok()) << result.error();
+}
+
+}  // namespace
+}  // namespace ascnd
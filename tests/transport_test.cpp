@@ -0,0 +1,258 @@
+/**
+ * @file transport_test.cpp
+ * @brief End-to-end tests against an in-process stand-in server
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#ifndef _WIN32
+#include <unistd.h>
+#endif
+
+namespace ascnd {
+namespace {
+
+class TransportTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+    ClientConfig config;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.connection_timeout_ms = 2000;
+        config.request_timeout_ms = 2000;
+        config.max_retries = 0;
+    }
+};
+
+// Construction must not contact the server; the channel is created lazily
+TEST_F(TransportTest, ConstructionDoesNotIssueRequests) {
+    AscndClient client(config);
+
+    EXPECT_EQ(service.submit_calls.load(), 0);
+    EXPECT_EQ(service.leaderboard_calls.load(), 0);
+    EXPECT_EQ(service.rank_calls.load(), 0);
+}
+
+// The first request transparently creates the channel
+TEST_F(TransportTest, FirstRequestSucceeds) {
+    AscndClient client(config);
+
+    auto result = client.submit_score("leaderboard", "player", 100);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().rank(), 1);
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+// ping() also initializes the channel on demand
+TEST_F(TransportTest, PingInitializesChannel) {
+    AscndClient client(config);
+
+    EXPECT_TRUE(client.ping());
+}
+
+// Concurrent first requests share a single lazily created channel
+TEST_F(TransportTest, ConcurrentFirstRequests) {
+    AscndClient client(config);
+
+    std::vector<std::future<Result<GetPlayerRankResponse>>> futures;
+    for (int i = 0; i < 8; ++i) {
+        GetPlayerRankRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player-" + std::to_string(i));
+        futures.push_back(client.get_player_rank_async(request));
+    }
+
+    for (auto& future : futures) {
+        EXPECT_TRUE(future.get().is_ok());
+    }
+    EXPECT_EQ(service.rank_calls.load(), 8);
+}
+
+// Requests on one client run concurrently rather than one at a time
+TEST_F(TransportTest, ConcurrentRequestsDoNotSerialize) {
+    service.read_delay_ms = 200;
+    AscndClient client(config);
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::future<Result<GetLeaderboardResponse>>> futures;
+    for (int i = 0; i < 4; ++i) {
+        GetLeaderboardRequest request;
+        request.set_leaderboard_id("leaderboard");
+        futures.push_back(client.get_leaderboard_async(request));
+    }
+    for (auto& future : futures) {
+        EXPECT_TRUE(future.get().is_ok());
+    }
+
+    // Serialized, four reads would take at least 800ms
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(600));
+}
+
+// Fire-and-forget submissions ask the server to omit the response body
+TEST_F(TransportTest, FireAndForgetOmitsResponse) {
+    AscndClient client(config);
+    std::promise<int> done;
+
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(100);
+    client.submit_score_fire_and_forget(request, [&done](int error_code, const std::string&) {
+        done.set_value(error_code);
+    });
+
+    EXPECT_EQ(done.get_future().get(), 0);
+    EXPECT_EQ(service.omitted_responses.load(), 1);
+}
+
+TEST_F(TransportTest, FireAndForgetReportsErrors) {
+    AscndClient client(config);
+    std::promise<std::pair<int, std::string>> done;
+
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("missing");
+    request.set_player_id("player");
+    request.set_score(100);
+    client.submit_score_fire_and_forget(request, [&done](int error_code, const std::string& message) {
+        done.set_value({error_code, message});
+    });
+
+    auto status = done.get_future().get();
+    EXPECT_EQ(status.first, static_cast<int>(grpc::StatusCode::NOT_FOUND));
+    EXPECT_EQ(status.second, "leaderboard not found");
+}
+
+// The destructor waits for fire-and-forget submissions still in flight
+TEST_F(TransportTest, DestructorWaitsForFireAndForget) {
+    {
+        AscndClient client(config);
+        SubmitScoreRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player");
+        for (int i = 0; i < 20; ++i) {
+            request.set_score(i);
+            client.submit_score_fire_and_forget(request);
+        }
+    }
+    EXPECT_EQ(service.submit_calls.load(), 20);
+}
+
+// Counters bumped from many threads at once add up exactly
+TEST_F(TransportTest, StatsCountRequestsFromAllThreads) {
+    service.set_player_rank("leaderboard", "player", 1);
+    AscndClient client(config);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&client]() {
+            for (int i = 0; i < 25; ++i) {
+                EXPECT_TRUE(client.get_player_rank("leaderboard", "player").is_ok());
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    EXPECT_FALSE(client.submit_score("missing", "player", 100).is_ok());
+
+    ClientStats stats = client.stats();
+    EXPECT_EQ(stats.requests_sent, 201u);
+    EXPECT_EQ(stats.requests_failed, 1u);
+}
+
+// An in-process channel bypasses the network stack entirely
+TEST_F(TransportTest, InProcessChannel) {
+    grpc::ChannelArguments args;
+    AscndClient client(ClientConfig{}, server->server()->InProcessChannel(args));
+
+    auto result = client.get_leaderboard("leaderboard", 5);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(result.value().entries_size(), 5);
+    EXPECT_EQ(client.config().server_address, "in-process");
+    EXPECT_FALSE(client.config().use_ssl);
+}
+
+#ifndef _WIN32
+// Unix domain socket addresses are served without TLS
+TEST(UnixSocketTransportTest, RequestOverUnixSocket) {
+    std::string address = "unix:" + ::testing::TempDir() + "ascnd_transport_test_" +
+                          std::to_string(getpid()) + ".sock";
+    testing::FakeAscndService service;
+    testing::FakeServer server(&service, grpc::InsecureServerCredentials(), address);
+
+    ClientConfig config;
+    config.server_address = address;
+    config.use_ssl = true;  // Turned off automatically for unix: addresses
+    config.request_timeout_ms = 2000;
+    config.max_retries = 0;
+    AscndClient client(config);
+
+    auto result = client.submit_score("leaderboard", "player", 42);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_FALSE(client.config().use_ssl);
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+#endif
+
+// Brackets sent once per response resolve like inline brackets
+TEST_F(TransportTest, BracketDictionaryResolvesEntries) {
+    AscndClient client(config);
+
+    GetLeaderboardRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_limit(100);
+    auto inline_result = client.get_leaderboard(request);
+    request.set_bracket_dictionary(true);
+    auto compact_result = client.get_leaderboard(request);
+
+    ASSERT_TRUE(inline_result.is_ok()) << inline_result.error();
+    ASSERT_TRUE(compact_result.is_ok()) << compact_result.error();
+    const auto& inline_response = inline_result.value();
+    const auto& compact_response = compact_result.value();
+    ASSERT_EQ(compact_response.brackets_size(), 2);
+    ASSERT_EQ(compact_response.entries_size(), inline_response.entries_size());
+
+    for (int i = 0; i < compact_response.entries_size(); ++i) {
+        const auto& entry = compact_response.entries(i);
+        EXPECT_FALSE(entry.has_bracket());
+        const BracketInfo* bracket = entry_bracket(compact_response, entry);
+        const BracketInfo* expected = entry_bracket(inline_response, inline_response.entries(i));
+        ASSERT_NE(bracket, nullptr);
+        ASSERT_NE(expected, nullptr);
+        EXPECT_EQ(bracket->id(), expected->id());
+        EXPECT_EQ(bracket->color(), expected->color());
+    }
+    EXPECT_LT(compact_response.ByteSizeLong() * 2, inline_response.ByteSizeLong());
+}
+
+TEST_F(TransportTest, EntryBracketHandlesMissingBrackets) {
+    GetLeaderboardResponse response;
+    auto* entry = response.add_entries();
+    EXPECT_EQ(entry_bracket(response, *entry), nullptr);
+
+    entry->set_bracket_index(3);  // Out of range
+    EXPECT_EQ(entry_bracket(response, *entry), nullptr);
+}
+
+}  // namespace
+}  // namespace ascnd
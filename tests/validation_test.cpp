@@ -0,0 +1,296 @@
+/**
+ * @file validation_test.cpp
+ * @brief Tests for local validation against cached leaderboard rules
+ */
+
+#include <gtest/gtest.h>
+#include "ascnd/client.hpp"
+#include "support/fake_server.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace ascnd {
+namespace {
+
+class ValidationTest : public ::testing::Test {
+protected:
+    testing::FakeAscndService service;
+    std::unique_ptr<testing::FakeServer> server;
+
+    void SetUp() override {
+        server = std::make_unique<testing::FakeServer>(&service);
+        ASSERT_NE(server->port(), 0);
+
+        GetLeaderboardRulesResponse rules;
+        rules.set_leaderboard_id("leaderboard");
+        rules.set_anticheat_enabled(true);
+        rules.set_min_score(0);
+        rules.set_max_score(1000);
+        rules.set_action("reject");
+        service.set_rules(rules);
+    }
+
+    std::unique_ptr<AscndClient> make_client(LocalValidation mode) {
+        ClientConfig config;
+        config.server_address = server->address();
+        config.api_key = "test-key";
+        config.use_ssl = false;
+        config.max_retries = 0;
+        config.local_validation = mode;
+        return std::make_unique<AscndClient>(config);
+    }
+};
+
+TEST_F(ValidationTest, OffByDefault) {
+    ClientConfig config;
+    EXPECT_EQ(config.local_validation, LocalValidation::kOff);
+
+    auto client = make_client(LocalValidation::kOff);
+    auto result = client->submit_score("leaderboard", "player", 5000);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(service.rules_calls.load(), 0);
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+TEST_F(ValidationTest, RejectsOutOfBoundsScoresWithoutSending) {
+    auto client = make_client(LocalValidation::kReject);
+    auto result = client->submit_score("leaderboard", "player", 5000);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_EQ(result.error_code(), static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+    EXPECT_NE(result.error().find("bounds_exceeded"), std::string::npos);
+    EXPECT_EQ(service.submit_calls.load(), 0);
+    EXPECT_EQ(client->stats().submissions_rejected_locally, 1u);
+}
+
+TEST_F(ValidationTest, ValidScoresAreSent) {
+    auto client = make_client(LocalValidation::kReject);
+    auto result = client->submit_score("leaderboard", "player", 500);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(service.submit_calls.load(), 1);
+    EXPECT_EQ(client->stats().submissions_rejected_locally, 0u);
+}
+
+TEST_F(ValidationTest, FlagModeSendsViolatingScores) {
+    auto client = make_client(LocalValidation::kFlag);
+    auto result = client->submit_score("leaderboard", "player", -5);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_EQ(service.submit_calls.load(), 1);
+    EXPECT_EQ(client->stats().submissions_flagged_locally, 1u);
+    EXPECT_EQ(client->stats().submissions_rejected_locally, 0u);
+}
+
+TEST_F(ValidationTest, RulesAreFetchedOncePerLeaderboard) {
+    auto client = make_client(LocalValidation::kReject);
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_TRUE(client->submit_score("leaderboard", "player", 100 + i).is_ok());
+    }
+    ASSERT_TRUE(client->submit_score("other-leaderboard", "player", 5000).is_ok());
+
+    EXPECT_EQ(service.rules_calls.load(), 2);
+    EXPECT_EQ(service.submit_calls.load(), 4);
+}
+
+TEST_F(ValidationTest, ExpiredRulesAreRefetched) {
+    GetLeaderboardRulesResponse rules;
+    rules.set_leaderboard_id("leaderboard");
+    rules.set_anticheat_enabled(true);
+    rules.set_max_score(1000);
+    service.set_rules(rules);
+
+    ClientConfig config;
+    config.server_address = server->address();
+    config.use_ssl = false;
+    config.max_retries = 0;
+    config.local_validation = LocalValidation::kReject;
+    config.rules_cache_ttl_ms = 1;
+    AscndClient client(config);
+
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+    ASSERT_TRUE(client.submit_score("leaderboard", "player", 100).is_ok());
+
+    EXPECT_EQ(service.rules_calls.load(), 2);
+}
+
+TEST_F(ValidationTest, RejectsScoresRisingTooFast) {
+    GetLeaderboardRulesResponse rules;
+    rules.set_leaderboard_id("leaderboard");
+    rules.set_anticheat_enabled(true);
+    rules.set_max_score_per_second(10.0);
+    service.set_rules(rules);
+
+    auto client = make_client(LocalValidation::kReject);
+    ASSERT_TRUE(client->submit_score("leaderboard", "player", 100).is_ok());
+    auto result = client->submit_score("leaderboard", "player", 100000);
+
+    ASSERT_TRUE(result.is_error());
+    EXPECT_NE(result.error().find("velocity_exceeded"), std::string::npos);
+
+    // Falling scores and other players are not limited
+    EXPECT_TRUE(client->submit_score("leaderboard", "player", 50).is_ok());
+    EXPECT_TRUE(client->submit_score("leaderboard", "other-player", 100000).is_ok());
+    EXPECT_EQ(service.submit_calls.load(), 3);
+}
+
+TEST_F(ValidationTest, RequiresIdempotencyKeyWhenConfigured) {
+    GetLeaderboardRulesResponse rules;
+    rules.set_leaderboard_id("leaderboard");
+    rules.set_anticheat_enabled(true);
+    rules.set_require_idempotency_key(true);
+    service.set_rules(rules);
+
+    auto client = make_client(LocalValidation::kReject);
+    auto rejected = client->submit_score("leaderboard", "player", 100);
+    ASSERT_TRUE(rejected.is_error());
+    EXPECT_NE(rejected.error().find("missing_idempotency_key"), std::string::npos);
+
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(100);
+    request.set_idempotency_key("match-1");
+    EXPECT_TRUE(client->submit_score(request).is_ok());
+}
+
+TEST_F(ValidationTest, DisabledAnticheatSkipsChecks) {
+    GetLeaderboardRulesResponse rules;
+    rules.set_leaderboard_id("leaderboard");
+    rules.set_anticheat_enabled(false);
+    rules.set_max_score(1000);
+    service.set_rules(rules);
+
+    auto client = make_client(LocalValidation::kReject);
+    EXPECT_TRUE(client->submit_score("leaderboard", "player", 5000).is_ok());
+}
+
+// Servers without the rules RPC leave enforcement to the server
+TEST_F(ValidationTest, UnavailableRulesSkipChecks) {
+    service.rules_supported = false;
+
+    auto client = make_client(LocalValidation::kReject);
+    EXPECT_TRUE(client->submit_score("leaderboard", "player", 5000).is_ok());
+    EXPECT_TRUE(client->submit_score("leaderboard", "player", 6000).is_ok());
+
+    EXPECT_EQ(service.submit_calls.load(), 2);
+}
+
+TEST_F(ValidationTest, AsyncSubmissionsAreValidated) {
+    auto client = make_client(LocalValidation::kReject);
+
+    auto future = client->submit_score_async([] {
+        SubmitScoreRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player");
+        request.set_score(5000);
+        return request;
+    }());
+    EXPECT_TRUE(future.get().is_error());
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool done = false;
+    int error_code = 0;
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(5000);
+    client->submit_score_fire_and_forget(request, [&](int code, const std::string&) {
+        std::lock_guard<std::mutex> lock(mutex);
+        error_code = code;
+        done = true;
+        cv.notify_all();
+    });
+
+    std::unique_lock<std::mutex> lock(mutex);
+    ASSERT_TRUE(cv.wait_for(lock, std::chrono::seconds(5), [&]() { return done; }));
+    EXPECT_EQ(error_code, static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+    EXPECT_EQ(service.submit_calls.load(), 0);
+    EXPECT_EQ(client->stats().submissions_rejected_locally, 2u);
+}
+
+TEST_F(ValidationTest, ConcurrentSubmissionsShareOneRulesFetch) {
+    service.rules_delay_ms = 100;
+    auto client = make_client(LocalValidation::kReject);
+
+    std::vector<std::future<Result<SubmitScoreResponse>>> futures;
+    for (int i = 0; i < 8; ++i) {
+        SubmitScoreRequest request;
+        request.set_leaderboard_id("leaderboard");
+        request.set_player_id("player-" + std::to_string(i));
+        request.set_score(i % 2 == 0 ? 500 : 5000);
+        futures.push_back(client->submit_score_async(request));
+    }
+    for (size_t i = 0; i < futures.size(); ++i) {
+        EXPECT_EQ(futures[i].get().is_ok(), i % 2 == 0);
+    }
+
+    EXPECT_EQ(service.rules_calls.load(), 1);
+    EXPECT_EQ(client->stats().submissions_rejected_locally, 4u);
+}
+
+// Fire-and-forget does not wait for rules: the first submission goes out
+// unchecked while they are fetched in the background
+TEST_F(ValidationTest, FireAndForgetDoesNotWaitForRules) {
+    service.rules_delay_ms = 300;
+    auto client = make_client(LocalValidation::kReject);
+    SubmitScoreRequest request;
+    request.set_leaderboard_id("leaderboard");
+    request.set_player_id("player");
+    request.set_score(5000);
+
+    std::promise<int> unchecked;
+    auto start = std::chrono::steady_clock::now();
+    client->submit_score_fire_and_forget(request, [&](int code, const std::string&) {
+        unchecked.set_value(code);
+    });
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::milliseconds(150));
+    EXPECT_EQ(unchecked.get_future().get(), 0);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(600));  // Rules arrive
+    std::promise<int> checked;
+    client->submit_score_fire_and_forget(request, [&](int code, const std::string&) {
+        checked.set_value(code);
+    });
+    EXPECT_EQ(checked.get_future().get(), static_cast<int>(grpc::StatusCode::INVALID_ARGUMENT));
+    EXPECT_EQ(service.rules_calls.load(), 1);
+    EXPECT_EQ(service.submit_calls.load(), 1);
+}
+
+TEST_F(ValidationTest, GetLeaderboardRulesReturnsRules) {
+    auto client = make_client(LocalValidation::kOff);
+
+    GetLeaderboardRulesRequest request;
+    request.set_leaderboard_id("leaderboard");
+    auto result = client->get_leaderboard_rules(request);
+
+    ASSERT_TRUE(result.is_ok()) << result.error();
+    EXPECT_TRUE(result.value().anticheat_enabled());
+    EXPECT_EQ(result.value().max_score(), 1000);
+    EXPECT_EQ(service.last_authorization(), "Bearer test-key");
+}
+
+// Prefetched rules are used without another round trip
+TEST_F(ValidationTest, PrefetchedRulesAreCached) {
+    auto client = make_client(LocalValidation::kReject);
+
+    GetLeaderboardRulesRequest request;
+    request.set_leaderboard_id("leaderboard");
+    ASSERT_TRUE(client->get_leaderboard_rules(request).is_ok());
+    EXPECT_TRUE(client->submit_score("leaderboard", "player", 5000).is_error());
+
+    EXPECT_EQ(service.rules_calls.load(), 1);
+}
+
+}  // namespace
+}  // namespace ascnd
@@ -11,6 +11,7 @@ vcpkg_cmake_configure(
     OPTIONS
         -DASCND_BUILD_EXAMPLES=OFF
         -DASCND_BUILD_TESTS=OFF
+        -DASCND_BUILD_PROXY=OFF
         -DASCND_INSTALL=ON
 )
 